@@ -2,9 +2,11 @@
 
 #include "Abilities/Tasks/GSCTask_PlayMontageWaitForEvent.h"
 #include "AI/Actors/EnemyProjectile.h"
+#include "AI/Components/ProAIBehaviorsComponent.h"
+#include "AI/Subsystems/EnemyProjectilePoolSubsystem.h"
+#include "AI/Utility/BallisticSolver.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/ProjectileMovementComponent.h"
-#include "Kismet/GameplayStatics.h"
 
 void UGameplayAbility_LongRangeProjectile::ActivateAbility(
 	const FGameplayAbilitySpecHandle Handle,
@@ -95,16 +97,18 @@ void UGameplayAbility_LongRangeProjectile::DoSpawnProjectile()
 		}
 	}
 
-	// 2) 투사체 액터 스폰
-	FActorSpawnParameters SpawnParams;
-	SpawnParams.Owner = const_cast<AActor*>(Avatar);
-	SpawnParams.Instigator = Cast<APawn>(const_cast<AActor*>(Avatar));
+	// 2) 투사체 액터를 풀에서 꺼내기 (없으면 풀이 스폰)
+	UEnemyProjectilePoolSubsystem* ProjectilePool = UWorld::GetSubsystem<UEnemyProjectilePoolSubsystem>(Avatar->GetWorld());
+	if (!ProjectilePool)
+	{
+		return;
+	}
 
-	AEnemyProjectile* SpawnedProjectile = Avatar->GetWorld()->SpawnActor<AEnemyProjectile>(
+	AEnemyProjectile* SpawnedProjectile = ProjectilePool->Acquire<AEnemyProjectile>(
 		ProjectileClass,
-		MuzzleLoc,
-		MuzzleRot,
-		SpawnParams
+		FTransform(MuzzleRot, MuzzleLoc),
+		Avatar,
+		Cast<APawn>(Avatar)
 	);
 
 	if (!SpawnedProjectile)
@@ -115,50 +119,40 @@ void UGameplayAbility_LongRangeProjectile::DoSpawnProjectile()
 	// 투사체에 적용할 효과 지정
 	SpawnedProjectile->DeBuffEffectClass = DebuffEffectClass;
 
-	// 플레이어 Pawn을 가져옴 (AI 상황이면 Blackboard 등에서 TargetActor를 가져오는 식으로 변경)
-	AActor* PlayerActor = UGameplayStatics::GetPlayerPawn(this, 0);
-
-	// (A) 플레이어가 없거나 ProjectileMovement가 없으면, 그냥 Forward 발사 후 리턴
-	if (!PlayerActor || !SpawnedProjectile->GetProjectileMovement())
+	UProjectileMovementComponent* ProjectileMovement = SpawnedProjectile->GetProjectileMovement();
+	if (!ProjectileMovement)
 	{
-		FVector DefaultVelocity = MuzzleRot.Vector() * SpawnedProjectile->GetProjectileMovement()->InitialSpeed;
-		SpawnedProjectile->GetProjectileMovement()->Velocity = DefaultVelocity;
 		return;
 	}
 
-	// (B) FSuggestProjectileVelocityParameters 사용 (신규 방식)
-	FVector OutVelocity;
-	FCollisionResponseParams CollisionParams;
-	TArray<AActor*> IgnoreActors;
-	IgnoreActors.Add(Avatar);
-
-	UGameplayStatics::FSuggestProjectileVelocityParameters Params(
-		this, 
-		MuzzleLoc,
-		PlayerActor->GetActorLocation(),
-		SpawnedProjectile->GetProjectileMovement()->InitialSpeed
-	);
-	Params.bFavorHighArc = false; // 낮은 포물선
-	Params.CollisionRadius = 0.f;
-	Params.OverrideGravityZ = 0.f; // 0이면 WorldGravity 사용
-	Params.TraceOption = ESuggestProjVelocityTraceOption::DoNotTrace; // 충돌 무시
-	Params.ResponseParam = CollisionParams;
-	Params.ActorsToIgnore = IgnoreActors;
-	Params.bDrawDebug = false;     // 디버그 궤적 표시
-
-	const bool bFoundValidVelocity = UGameplayStatics::SuggestProjectileVelocity(Params, OutVelocity);
-
-	if (bFoundValidVelocity)
+	// AI가 선택한 공격 대상을 조준
+	AActor* TargetActor = nullptr;
+	if (const UProAIBehaviorsComponent* BehaviorsComp = Avatar->FindComponentByClass<UProAIBehaviorsComponent>())
 	{
-		// 필요하다면 OutVelocity *= 0.7f 등으로 속도 조정
-		SpawnedProjectile->GetProjectileMovement()->Velocity = OutVelocity ;
+		TargetActor = BehaviorsComp->AttackTarget;
 	}
-	else
+
+	// (A) 대상이 없으면 그냥 Forward 발사 후 리턴
+	const FVector DefaultVelocity = MuzzleRot.Vector() * ProjectileMovement->InitialSpeed;
+	if (!IsValid(TargetActor))
 	{
-		// 사거리 불충분 등으로 계산 실패 시 fallback
-		FVector FallbackVelocity = MuzzleRot.Vector() * SpawnedProjectile->GetProjectileMovement()->InitialSpeed;
-		SpawnedProjectile->GetProjectileMovement()->Velocity = FallbackVelocity;
+		ProjectileMovement->Velocity = DefaultVelocity;
+		return;
 	}
+
+	// (B) 해석해 포물선 + 대상 이동 예측 (충돌 트레이스 없음)
+	FBallisticSolveRequest Request;
+	Request.Start = MuzzleLoc;
+	Request.TargetLocation = TargetActor->GetActorLocation();
+	Request.TargetVelocity = bLeadTarget ? TargetActor->GetVelocity() : FVector::ZeroVector;
+	Request.Speed = ProjectileMovement->InitialSpeed;
+	Request.GravityZ = ProjectileMovement->GetGravityZ();
+	Request.bHighArc = false; // 낮은 포물선
+
+	const FBallisticSolution Solution = FBallisticSolver::Solve(Request);
+
+	// 사거리 불충분 등으로 계산 실패 시 fallback
+	ProjectileMovement->Velocity = Solution.bValid ? Solution.Velocity : DefaultVelocity;
 }
 
 void UGameplayAbility_LongRangeProjectile::OnMontageCompleted(FGameplayTag EventTag, FGameplayEventData EventData)
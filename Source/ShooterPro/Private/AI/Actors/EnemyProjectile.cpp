@@ -2,15 +2,17 @@
 
 #include "AbilitySystemComponent.h"
 #include "AbilitySystemInterface.h"
+#include "AbilitySystem/ProEffectSpecCacheSubsystem.h"
 #include "GameplayEffectTypes.h"
 #include "NiagaraComponent.h"
-#include "NiagaraFunctionLibrary.h"
 #include "AI/EnemyAIController.h"
 #include "AI/Actors/ProjectileAOEActor.h"
 #include "AI/Interfaces/Interface_EnemyAI.h"
+#include "AI/Subsystems/EnemyProjectilePoolSubsystem.h"
 #include "Blueprint/AIBlueprintHelperLibrary.h"
 #include "Components/SphereComponent.h"
 #include "GameFramework/ProjectileMovementComponent.h"
+#include "System/ProFXManagerSubsystem.h"
 
 #include "Kismet/GameplayStatics.h"
 
@@ -43,8 +45,8 @@ AEnemyProjectile::AEnemyProjectile()
 	ProjectileVomitNiagara->SetupAttachment(RootComponent);
 	ProjectileVomitNiagara->bAutoActivate = true; // 코드로 수동 Activate
 
-	// 자동 제거 시간
-	InitialLifeSpan = 10.0f;
+	// 수명은 풀이 관리 (PooledLifeSpan)
+	InitialLifeSpan = 0.0f;
 
 	// 충돌 이벤트
 	CollisionSphere->OnComponentHit.AddDynamic(this, &AEnemyProjectile::OnHit);
@@ -63,26 +65,61 @@ void AEnemyProjectile::BeginPlay()
 	}
 }
 
+void AEnemyProjectile::OnAcquiredFromPool()
+{
+	SetActorHiddenInGame(false);
+	SetActorEnableCollision(true);
+
+	ProjectileMovement->SetUpdatedComponent(CollisionSphere);
+	ProjectileMovement->Velocity = GetActorForwardVector() * ProjectileMovement->InitialSpeed;
+	ProjectileMovement->Activate(true);
+
+	// 이전 비행의 파티클이 남지 않도록 처음부터 다시 재생
+	if (FlyingVomitNiagara)
+	{
+		ProjectileVomitNiagara->SetAsset(FlyingVomitNiagara);
+		ProjectileVomitNiagara->Activate(true);
+	}
+}
+
+void AEnemyProjectile::OnReleasedToPool()
+{
+	SetActorHiddenInGame(true);
+	SetActorEnableCollision(false);
+
+	ProjectileMovement->StopMovementImmediately();
+	ProjectileMovement->Deactivate();
+
+	ProjectileVomitNiagara->DeactivateImmediate();
+
+	// 어빌리티가 바꿔둔 값은 클래스 기본값으로 되돌림
+	DeBuffEffectClass = GetDefault<AEnemyProjectile>(GetClass())->DeBuffEffectClass;
+}
+
 void AEnemyProjectile::OnHit(UPrimitiveComponent* HitComp, AActor* OtherActor, UPrimitiveComponent* OtherComp,
                              FVector NormalImpulse, const FHitResult& Hit)
 {
+	// 이번 이동에서 이미 반납됐으면 무시 (Instigator도 비어 있음)
+	if (!UEnemyProjectilePoolSubsystem::IsActorInUse(this))
+		return;
+
 	AActor* MyInstigator = GetInstigator();
 	if (OtherActor && OtherActor != this && OtherActor != MyInstigator)
 	{
 		// 벽/바닥 충돌 시
 		if (ImpactEffectWorld)
 		{
-			// Niagara에서는 SpawnEmitterAtLocation 대신 SpawnSystemAtLocation 사용
-			UNiagaraFunctionLibrary::SpawnSystemAtLocation(
-				GetWorld(),
+			// 풀/예산을 거쳐 재생 (난전 중 피격 이펙트 폭증 방지)
+			UProFXManagerSubsystem::SpawnSystemAtLocation(
+				this,
 				ImpactEffectWorld,
 				Hit.ImpactPoint,
 				Hit.ImpactNormal.Rotation(), ImpactScale
 			);
 		}
 
-		// 투사체 제거
-		Destroy();
+		// 투사체 반납
+		UEnemyProjectilePoolSubsystem::ReleaseOrDestroy(this);
 	}
 
 
@@ -96,13 +133,17 @@ void AEnemyProjectile::OnHit(UPrimitiveComponent* HitComp, AActor* OtherActor, U
 void AEnemyProjectile::OnOverlapBegin(UPrimitiveComponent* OverlappedComp, AActor* OtherActor, UPrimitiveComponent* OtherComp,
                                       int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
 {
+	// 이번 이동에서 이미 반납됐으면 무시 (Instigator도 비어 있음)
+	if (!UEnemyProjectilePoolSubsystem::IsActorInUse(this))
+		return;
+
 	AActor* MyInstigator = GetInstigator();
 
 
 	if (OtherActor && OtherActor != this && OtherActor != MyInstigator)
 	{
 		AEnemyAIController* EnemyAIController = Cast<AEnemyAIController>(UAIBlueprintHelperLibrary::GetAIController(MyInstigator));
-		if (EnemyAIController->OnSameTeam(OtherActor))
+		if (EnemyAIController && EnemyAIController->OnSameTeam(OtherActor))
 		{
 			return;
 		}
@@ -110,15 +151,13 @@ void AEnemyProjectile::OnOverlapBegin(UPrimitiveComponent* OverlappedComp, AActo
 		// 플레이어(또는 적 NPC)에 피격 시 이펙트
 		if (ImpactEffectPlayer)
 		{
-			// Niagara 에서는 SpawnSystemAttached 사용
-			UNiagaraFunctionLibrary::SpawnSystemAttached(
+			UProFXManagerSubsystem::SpawnSystemAttached(
 				ImpactEffectPlayer,
 				OtherActor->GetRootComponent(),
 				FName("spine_03"), // 본/소켓명 (필요에 따라 "")
 				FVector::ZeroVector,
 				FRotator::ZeroRotator,
-				EAttachLocation::SnapToTargetIncludingScale,
-				true // bAutoDestroy
+				EAttachLocation::SnapToTargetIncludingScale
 			);
 
 			// 디버프 (GAS)
@@ -134,24 +173,19 @@ void AEnemyProjectile::OnOverlapBegin(UPrimitiveComponent* OverlappedComp, AActo
 
 				if (TargetASC && SourceASC && DeBuffEffectClass)
 				{
-					FGameplayEffectContextHandle ContextHandle = SourceASC->MakeEffectContext();
-					ContextHandle.AddSourceObject(this);
-
-					FGameplayEffectSpecHandle SpecHandle = SourceASC->MakeOutgoingSpec(
-						DeBuffEffectClass,
-						1.0f,
-						ContextHandle
-					);
-					if (SpecHandle.IsValid())
-					{
-						SourceASC->ApplyGameplayEffectSpecToTarget(*SpecHandle.Data.Get(), TargetASC);
-					}
+					FProEffectApplication Application;
+					Application.SourceASC = SourceASC;
+					Application.TargetASC = TargetASC;
+					Application.EffectClass = DeBuffEffectClass;
+					Application.SourceObject = MyInstigator;
+					Application.HitSourceObject = this;
+					UProEffectSpecCacheSubsystem::Apply(this, MoveTemp(Application));
 				}
 			}
 		}
 
 
-		// 제거
-		Destroy();
+		// 반납
+		UEnemyProjectilePoolSubsystem::ReleaseOrDestroy(this);
 	}
 }
@@ -1,5 +1,6 @@
 #include "AI/Actors/PatrolPath.h"
 
+#include "Algo/BinarySearch.h"
 #include "Components/BillboardComponent.h"
 #include "Components/SplineComponent.h"
 
@@ -21,6 +22,15 @@ APatrolPath::APatrolPath()
 	BillboardComponent->SetRelativeLocation(FVector(0.0f, 0.0f, 40.0f));
 }
 
+void APatrolPath::PostInitializeComponents()
+{
+	Super::PostInitializeComponents();
+
+	// 베이크 데이터는 저장되지 않으므로 런타임에 다시 만든다.
+	// BeginPlay보다 먼저 호출되므로 AI가 빙의되는 시점에는 항상 준비되어 있다.
+	BakePatrolRoute();
+}
+
 void APatrolPath::BeginPlay()
 {
 	Super::BeginPlay();
@@ -29,24 +39,154 @@ void APatrolPath::BeginPlay()
 void APatrolPath::OnConstruction(const FTransform& Transform)
 {
 	Super::OnConstruction(Transform);
+
+	BakePatrolRoute();
 }
 
 void APatrolPath::IncrementPatrolRoute()
 {
-	int32 StepDirection = (bPatrolReverseDirection) ? -1 : 1;
-	int32 SplinePointNum = SplineComponent->GetNumberOfSplinePoints() - 1;
+	FPatrolRouteCursor SharedCursor;
+	SharedCursor.PatrolIndex = PatrolIndex;
+	SharedCursor.bReverseDirection = bPatrolReverseDirection;
 
-	PatrolIndex += StepDirection;
+	AdvancePatrolCursor(SharedCursor);
 
-	if (PatrolIndex >= SplinePointNum)
-		bPatrolReverseDirection = true;
-	else if (PatrolIndex == 0)
-		bPatrolReverseDirection = false;
+	PatrolIndex = SharedCursor.PatrolIndex;
+	bPatrolReverseDirection = SharedCursor.bReverseDirection;
 }
 
 FVector APatrolPath::GetSplinePointAsWorldPosition()
 {
-	return SplineComponent->GetLocationAtSplinePoint(PatrolIndex, ESplineCoordinateSpace::World);
+	return GetPatrolPointLocation(PatrolIndex);
+}
+
+void APatrolPath::BakePatrolRoute()
+{
+	PatrolPoints.Reset();
+	PatrolPointDistances.Reset();
+	RouteSamples.Reset();
+	RouteSampleDistances.Reset();
+	RouteLength = 0.0f;
+	bClosedLoop = false;
+
+	if (!SplineComponent)
+		return;
+
+	const int32 NumSplinePoints = SplineComponent->GetNumberOfSplinePoints();
+	if (NumSplinePoints <= 0)
+		return;
+
+	bClosedLoop = SplineComponent->IsClosedLoop();
+	RouteLength = SplineComponent->GetSplineLength();
+
+	// 1) 순찰 목표가 되는 스플라인 포인트와 누적 거리
+	PatrolPoints.Reserve(NumSplinePoints);
+	PatrolPointDistances.Reserve(NumSplinePoints);
+	for (int32 PointIndex = 0; PointIndex < NumSplinePoints; ++PointIndex)
+	{
+		PatrolPoints.Add(SplineComponent->GetLocationAtSplinePoint(PointIndex, ESplineCoordinateSpace::World));
+		PatrolPointDistances.Add(SplineComponent->GetDistanceAlongSplineAtSplinePoint(PointIndex));
+	}
+
+	// 2) 가장 가까운 지점 검색용 폴리라인 샘플 (끝점 포함)
+	const int32 NumSegments = FMath::Max(1, FMath::CeilToInt(RouteLength / RouteSampleSpacing));
+	RouteSamples.Reserve(NumSegments + 1);
+	RouteSampleDistances.Reserve(NumSegments + 1);
+	for (int32 SampleIndex = 0; SampleIndex <= NumSegments; ++SampleIndex)
+	{
+		const float Distance = RouteLength * static_cast<float>(SampleIndex) / static_cast<float>(NumSegments);
+		RouteSamples.Add(SplineComponent->GetLocationAtDistanceAlongSpline(Distance, ESplineCoordinateSpace::World));
+		RouteSampleDistances.Add(Distance);
+	}
+}
+
+void APatrolPath::AdvancePatrolCursor(FPatrolRouteCursor& Cursor) const
+{
+	const int32 LastPointIndex = PatrolPoints.Num() - 1;
+	if (LastPointIndex <= 0)
+	{
+		Cursor.PatrolIndex = 0;
+		return;
+	}
+
+	// 닫힌 루프는 방향 전환 없이 순환
+	if (bClosedLoop)
+	{
+		const int32 StepDirection = Cursor.bReverseDirection ? -1 : 1;
+		Cursor.PatrolIndex = (Cursor.PatrolIndex + StepDirection + PatrolPoints.Num()) % PatrolPoints.Num();
+		return;
+	}
+
+	const int32 StepDirection = Cursor.bReverseDirection ? -1 : 1;
+	Cursor.PatrolIndex = FMath::Clamp(Cursor.PatrolIndex + StepDirection, 0, LastPointIndex);
+
+	if (Cursor.PatrolIndex >= LastPointIndex)
+		Cursor.bReverseDirection = true;
+	else if (Cursor.PatrolIndex == 0)
+		Cursor.bReverseDirection = false;
+}
+
+FVector APatrolPath::GetPatrolCursorLocation(const FPatrolRouteCursor& Cursor) const
+{
+	return GetPatrolPointLocation(Cursor.PatrolIndex);
+}
+
+FVector APatrolPath::GetPatrolPointLocation(int32 PointIndex) const
+{
+	if (!IsBaked())
+		return GetActorLocation();
+
+	return PatrolPoints[FMath::Clamp(PointIndex, 0, PatrolPoints.Num() - 1)];
+}
+
+FVector APatrolPath::FindNearestPointOnRoute(const FVector& WorldLocation, float& OutDistanceAlongRoute, int32& OutNextPointIndex) const
+{
+	OutDistanceAlongRoute = 0.0f;
+	OutNextPointIndex = 0;
+
+	if (!IsBaked())
+		return GetActorLocation();
+
+	if (RouteSamples.Num() < 2)
+		return PatrolPoints[0];
+
+	// 폴리라인의 각 선분에 투영하여 제곱 거리 기준으로 최단 지점 선택
+	FVector BestLocation = RouteSamples[0];
+	float BestDistSquared = TNumericLimits<float>::Max();
+	for (int32 SegmentIndex = 0; SegmentIndex < RouteSamples.Num() - 1; ++SegmentIndex)
+	{
+		const FVector& SegmentStart = RouteSamples[SegmentIndex];
+		const FVector& SegmentEnd = RouteSamples[SegmentIndex + 1];
+		const FVector Candidate = FMath::ClosestPointOnSegment(WorldLocation, SegmentStart, SegmentEnd);
+		const float DistSquared = FVector::DistSquared(WorldLocation, Candidate);
+		if (DistSquared < BestDistSquared)
+		{
+			BestDistSquared = DistSquared;
+			BestLocation = Candidate;
+
+			const float ChordLength = FVector::Dist(SegmentStart, SegmentEnd);
+			const float Alpha = ChordLength > KINDA_SMALL_NUMBER ? FVector::Dist(SegmentStart, Candidate) / ChordLength : 0.0f;
+			const float SegmentLength = RouteSampleDistances[SegmentIndex + 1] - RouteSampleDistances[SegmentIndex];
+			OutDistanceAlongRoute = RouteSampleDistances[SegmentIndex] + SegmentLength * FMath::Clamp(Alpha, 0.0f, 1.0f);
+		}
+	}
+
+	// 누적 거리가 더 큰 첫 번째 순찰 포인트가 '다음' 포인트
+	OutNextPointIndex = Algo::UpperBound(PatrolPointDistances, OutDistanceAlongRoute);
+	if (OutNextPointIndex >= PatrolPoints.Num())
+		OutNextPointIndex = bClosedLoop ? 0 : PatrolPoints.Num() - 1;
+
+	return BestLocation;
+}
+
+void APatrolPath::ResetCursorToNearestPoint(const FVector& WorldLocation, FPatrolRouteCursor& Cursor) const
+{
+	float DistanceAlongRoute = 0.0f;
+	int32 NextPointIndex = 0;
+	FindNearestPointOnRoute(WorldLocation, DistanceAlongRoute, NextPointIndex);
+
+	Cursor.PatrolIndex = NextPointIndex;
+	Cursor.bReverseDirection = !bClosedLoop && NextPointIndex >= PatrolPoints.Num() - 1;
 }
 
 
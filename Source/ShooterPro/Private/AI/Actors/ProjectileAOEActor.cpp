@@ -1,9 +1,9 @@
 #include "AI/Actors/ProjectileAOEActor.h"
 
-#include "AbilitySystemComponent.h"
-#include "AbilitySystemInterface.h"
+#include "AI/Subsystems/EnemyProjectilePoolSubsystem.h"
 #include "GameplayEffect.h"
 #include "Components/SphereComponent.h"
+#include "Engine/CollisionProfile.h"
 
 AProjectileAOEActor::AProjectileAOEActor()
 {
@@ -14,7 +14,7 @@ AProjectileAOEActor::AProjectileAOEActor()
 
 	AOETriggerSphere = CreateDefaultSubobject<USphereComponent>(TEXT("AOETriggerSphere"));
 	AOETriggerSphere->InitSphereRadius(200.f);
-	AOETriggerSphere->SetCollisionProfileName(TEXT("OverlapAll")); // 필요에 따라 커스텀
+	AOETriggerSphere->SetCollisionProfileName(UCollisionProfile::NoCollision_ProfileName); // 판정은 UAoEZoneSubsystem이 담당
 	AOETriggerSphere->SetupAttachment(RootComponent);
 	
 	AoeDuration = 5.f; // 5초 후 AoE 제거
@@ -23,36 +23,61 @@ AProjectileAOEActor::AProjectileAOEActor()
 void AProjectileAOEActor::BeginPlay()
 {
 	Super::BeginPlay();
-	// Overlap 이벤트 바인딩
-	AOETriggerSphere->OnComponentBeginOverlap.AddDynamic(this, &AProjectileAOEActor::OnOverlapBegin);
+	RegisterZone();
 
-	// 일정 시간 후 파괴
+	// 일정 시간 후 파괴 (풀에서 꺼낸 경우에는 OnReleasedToPool에서 해제되고 수명은 풀이 관리)
 	GetWorldTimerManager().SetTimer(AoeTimerHandle, this, &AProjectileAOEActor::DestroyAOE, AoeDuration, false);
 }
 
-void AProjectileAOEActor::OnOverlapBegin(UPrimitiveComponent* OverlappedComp, AActor* OtherActor, UPrimitiveComponent* OtherComp,
-                                         int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
+void AProjectileAOEActor::OnAcquiredFromPool()
 {
-	// AbilitySystem이 있는 Pawn/Actor라면 Debuff 적용
-	if (IAbilitySystemInterface* ASInterface = Cast<IAbilitySystemInterface>(OtherActor))
+	SetActorHiddenInGame(false);
+	SetActorEnableCollision(true);
+
+	// 새 위치에서 장판 등록 (이미 범위 안에 있던 대상도 다음 펄스에 적용됨)
+	RegisterZone();
+}
+
+void AProjectileAOEActor::OnReleasedToPool()
+{
+	GetWorldTimerManager().ClearTimer(AoeTimerHandle);
+	UnregisterZone();
+
+	SetActorHiddenInGame(true);
+	SetActorEnableCollision(false);
+}
+
+void AProjectileAOEActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UnregisterZone();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void AProjectileAOEActor::RegisterZone()
+{
+	UAoEZoneSubsystem* AoEZoneSubsystem = UWorld::GetSubsystem<UAoEZoneSubsystem>(GetWorld());
+	if (!AoEZoneSubsystem || ZoneHandle.IsValid())
+		return;
+
+	// 여기서는 Source 없이 대상 자신이 소스라고 가정 (SourceASC 미지정). 수명은 풀/타이머가 관리
+	FProAoEZoneParams Params;
+	Params.EffectClass = AOEEffectClass;
+	Params.Radius = AOETriggerSphere->GetScaledSphereRadius();
+	Params.DamageInterval = DamageInterval;
+	ZoneHandle = AoEZoneSubsystem->AddZone(Params, GetActorLocation(), this);
+}
+
+void AProjectileAOEActor::UnregisterZone()
+{
+	if (UAoEZoneSubsystem* AoEZoneSubsystem = UWorld::GetSubsystem<UAoEZoneSubsystem>(GetWorld()))
 	{
-		UAbilitySystemComponent* TargetASC = ASInterface->GetAbilitySystemComponent();
-		// 여기서는 Source 없이 자기 자신이 소스라고 가정
-		if (TargetASC && AOEEffectClass)
-		{
-			FGameplayEffectContextHandle ContextHandle = TargetASC->MakeEffectContext();
-			ContextHandle.AddSourceObject(this);
-
-			FGameplayEffectSpecHandle SpecHandle = TargetASC->MakeOutgoingSpec(AOEEffectClass, 1.f, ContextHandle);
-			if (SpecHandle.IsValid())
-			{
-				TargetASC->ApplyGameplayEffectSpecToTarget(*SpecHandle.Data.Get(), TargetASC);
-			}
-		}
+		AoEZoneSubsystem->RemoveZone(ZoneHandle);
 	}
+	ZoneHandle.Invalidate();
 }
 
 void AProjectileAOEActor::DestroyAOE()
 {
-	Destroy();
+	UEnemyProjectilePoolSubsystem::ReleaseOrDestroy(this);
 }
@@ -57,6 +57,37 @@ void UProAIBehaviorsComponent::InitializeBehavior(AEnemyAIController* PossedCont
 	AIControllerRef->UpdateBlackboard_DefendRadius(GetDefendRadius());
 	AIControllerRef->UpdateBlackboard_StartLocation(GetOwner()->GetActorLocation());
 	AIControllerRef->UpdateBlackboard_MaxRandRadius(GetMaxRandRadius());
+
+	ResetPatrolToNearestPoint();
+}
+
+APatrolPath* UProAIBehaviorsComponent::GetPatrolRoute() const
+{
+	AActor* Owner = GetOwner();
+	if (!Owner || !Owner->Implements<UInterface_EnemyAI>())
+		return nullptr;
+
+	return IInterface_EnemyAI::Execute_GetPatrolPath(Owner);
+}
+
+FVector UProAIBehaviorsComponent::GetPatrolLocation() const
+{
+	if (APatrolPath* PatrolRoute = GetPatrolRoute())
+		return PatrolRoute->GetPatrolCursorLocation(PatrolCursor);
+
+	return GetOwner()->GetActorLocation();
+}
+
+void UProAIBehaviorsComponent::AdvancePatrol()
+{
+	if (APatrolPath* PatrolRoute = GetPatrolRoute())
+		PatrolRoute->AdvancePatrolCursor(PatrolCursor);
+}
+
+void UProAIBehaviorsComponent::ResetPatrolToNearestPoint()
+{
+	if (APatrolPath* PatrolRoute = GetPatrolRoute())
+		PatrolRoute->ResetCursorToNearestPoint(GetOwner()->GetActorLocation(), PatrolCursor);
 }
 
 bool UProAIBehaviorsComponent::IsTriggerEnabled(ECombatTriggerFlags Trigger) const
@@ -4,6 +4,7 @@
 #include "AI/Decorator/BTDecorator_CheckDistanceToTarget.h"
 
 #include "AI/EnemyAIController.h"
+#include "AI/Subsystems/DistanceBandSubsystem.h"
 #include "BehaviorTree/BlackboardComponent.h"
 
 
@@ -49,6 +50,8 @@ void UBTDecorator_CheckDistanceToTarget::OnBecomeRelevant(UBehaviorTreeComponent
 			BBComp->RegisterObserver(TargetActorKey.GetSelectedKeyID(), this, BBDelegate2);
 		}
 	}
+
+	RegisterDistanceBand(OwnerComp, NodeMemory);
 }
 
 void UBTDecorator_CheckDistanceToTarget::OnCeaseRelevant(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
@@ -60,6 +63,73 @@ void UBTDecorator_CheckDistanceToTarget::OnCeaseRelevant(UBehaviorTreeComponent&
 		// 이 Decorator(=this)에 등록된 옵저버를 전부 해제
 		BBComp->UnregisterObserversFrom(this);
 	}
+
+	UnregisterDistanceBand(OwnerComp, NodeMemory);
+}
+
+void UBTDecorator_CheckDistanceToTarget::InitializeMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryInit::Type InitType) const
+{
+	InitializeNodeMemory<FBTCheckDistanceToTargetMemory>(NodeMemory, InitType);
+}
+
+void UBTDecorator_CheckDistanceToTarget::CleanupMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryClear::Type CleanupType) const
+{
+	// 트리가 통째로 정리되는 경우에도 서브시스템에 남지 않도록 해제
+	UnregisterDistanceBand(OwnerComp, NodeMemory);
+
+	CleanupNodeMemory<FBTCheckDistanceToTargetMemory>(NodeMemory, CleanupType);
+}
+
+bool UBTDecorator_CheckDistanceToTarget::GetTargetAndThreshold(const UBlackboardComponent& BlackboardComp, AActor*& OutTargetActor, float& OutThreshold) const
+{
+	OutTargetActor = Cast<AActor>(BlackboardComp.GetValueAsObject(TargetActorKey.SelectedKeyName));
+	OutThreshold = bUseCustomDistance ? CustomDistance : BlackboardComp.GetValueAsFloat(RangeKey.SelectedKeyName);
+	return OutTargetActor != nullptr;
+}
+
+void UBTDecorator_CheckDistanceToTarget::RegisterDistanceBand(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
+{
+	if (!bMonitorDistance)
+		return;
+
+	FBTCheckDistanceToTargetMemory* MyMemory = CastInstanceNodeMemory<FBTCheckDistanceToTargetMemory>(NodeMemory);
+	UDistanceBandSubsystem* DistanceBands = UWorld::GetSubsystem<UDistanceBandSubsystem>(OwnerComp.GetWorld());
+	const UBlackboardComponent* BBComp = OwnerComp.GetBlackboardComponent();
+	const AAIController* AIController = OwnerComp.GetAIOwner();
+	if (!MyMemory || !DistanceBands || !BBComp || !AIController)
+		return;
+
+	AActor* TargetActor = nullptr;
+	float DistanceThreshold = 0.0f;
+	GetTargetAndThreshold(*BBComp, TargetActor, DistanceThreshold);
+
+	// 경계를 넘는 프레임에만 호출됨 -> 상태 갱신 후 재평가 요청
+	TWeakObjectPtr<UBehaviorTreeComponent> WeakOwnerComp = &OwnerComp;
+	FOnDistanceBandChanged Callback = FOnDistanceBandChanged::CreateWeakLambda(this, [this, WeakOwnerComp, MyMemory](bool bInside)
+	{
+		if (UBehaviorTreeComponent* BTComp = WeakOwnerComp.Get())
+		{
+			MyMemory->bInside = bInside;
+			ConditionalFlowAbort(*BTComp, EBTDecoratorAbortRequest::ConditionResultChanged);
+		}
+	});
+
+	UnregisterDistanceBand(OwnerComp, NodeMemory);
+	MyMemory->BandHandle = DistanceBands->RegisterBand(AIController->GetPawn(), TargetActor, DistanceThreshold, DistanceHysteresis, MoveTemp(Callback), MyMemory->bInside);
+}
+
+void UBTDecorator_CheckDistanceToTarget::UnregisterDistanceBand(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) const
+{
+	FBTCheckDistanceToTargetMemory* MyMemory = CastInstanceNodeMemory<FBTCheckDistanceToTargetMemory>(NodeMemory);
+	if (!MyMemory || MyMemory->BandHandle == UDistanceBandSubsystem::InvalidHandle)
+		return;
+
+	if (UDistanceBandSubsystem* DistanceBands = UWorld::GetSubsystem<UDistanceBandSubsystem>(OwnerComp.GetWorld()))
+	{
+		DistanceBands->UnregisterBand(MyMemory->BandHandle);
+	}
+
+	MyMemory->BandHandle = UDistanceBandSubsystem::InvalidHandle;
 }
 
 bool UBTDecorator_CheckDistanceToTarget::CalculateRawConditionValue(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) const
@@ -70,17 +140,26 @@ bool UBTDecorator_CheckDistanceToTarget::CalculateRawConditionValue(UBehaviorTre
 	UBlackboardComponent* BlackboardComp = OwnerComp.GetBlackboardComponent();
 	if (!BlackboardComp) return false;
 
-	AActor* TargetActor = Cast<AActor>(BlackboardComp->GetValueAsObject(TargetActorKey.SelectedKeyName));
-	if (!TargetActor) return false;
+	AActor* TargetActor = nullptr;
+	float DistanceThreshold = 0.0f;
+	if (!GetTargetAndThreshold(*BlackboardComp, TargetActor, DistanceThreshold)) return false;
 
 	AActor* SelfActor = AIController->GetPawn();
 	if (!SelfActor) return false;
 
-	const float DistanceToTarget = FVector::Dist(SelfActor->GetActorLocation(), TargetActor->GetActorLocation());
-	const float DistanceThreshold = bUseCustomDistance ? CustomDistance : BlackboardComp->GetValueAsFloat(RangeKey.SelectedKeyName);
+	// 조건: 거리 ≤ 임계값 (제곱 거리로 비교, 이미 안쪽이었다면 히스테리시스만큼 여유를 둠)
+	FBTCheckDistanceToTargetMemory* MyMemory = CastInstanceNodeMemory<FBTCheckDistanceToTargetMemory>(NodeMemory);
+	const bool bWasInside = MyMemory && MyMemory->bInside;
+	const float DistSquaredToTarget = FVector::DistSquared(SelfActor->GetActorLocation(), TargetActor->GetActorLocation());
+	const float Hysteresis = bMonitorDistance ? DistanceHysteresis : 0.0f;
+	const bool bInside = UDistanceBandSubsystem::EvaluateBand(DistSquaredToTarget, DistanceThreshold, Hysteresis, bWasInside);
 
-	// 조건: 거리 ≤ 임계값
-	return (DistanceToTarget <= DistanceThreshold);
+	if (MyMemory)
+	{
+		MyMemory->bInside = bInside;
+	}
+
+	return bInside;
 }
 
 EBlackboardNotificationResult UBTDecorator_CheckDistanceToTarget::OnBBValueChanged(const UBlackboardComponent& BlackboardComponent, FBlackboard::FKey Key, UBehaviorTreeComponent* BehaviorTreeComponent, unsigned char* Arg)
@@ -94,6 +173,19 @@ EBlackboardNotificationResult UBTDecorator_CheckDistanceToTarget::OnBBValueChang
 	// Decorator 메모리
 	uint8* NodeMemory = static_cast<uint8*>(Arg);
 
+	// 타겟/임계값이 바뀌었으면 거리 밴드도 갱신
+	FBTCheckDistanceToTargetMemory* MyMemory = CastInstanceNodeMemory<FBTCheckDistanceToTargetMemory>(NodeMemory);
+	if (MyMemory && MyMemory->BandHandle != UDistanceBandSubsystem::InvalidHandle)
+	{
+		if (UDistanceBandSubsystem* DistanceBands = UWorld::GetSubsystem<UDistanceBandSubsystem>(BehaviorTreeComponent->GetWorld()))
+		{
+			AActor* TargetActor = nullptr;
+			float DistanceThreshold = 0.0f;
+			GetTargetAndThreshold(BlackboardComponent, TargetActor, DistanceThreshold);
+			MyMemory->bInside = DistanceBands->UpdateBand(MyMemory->BandHandle, TargetActor, DistanceThreshold);
+		}
+	}
+
 	// --- 핵심 변경 ---
 	// Decorator가 "값이 바뀌었다"는 것을 엔진에 알려,
 	// FlowAbortMode 설정(EBTFlowAbortMode::LowerPriority)에 맞추어 자동 Abort/재실행하도록 함
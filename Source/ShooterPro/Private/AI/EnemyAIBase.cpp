@@ -6,10 +6,13 @@
 #include "AI/AIGameplayTags.h"
 #include "AI/EnemyAIController.h"
 #include "AI/Components/ProAIBehaviorsComponent.h"
+#include "AI/Subsystems/CrowdSeparationSubsystem.h"
+#include "AI/Subsystems/TacticalInfluenceSubsystem.h"
 
 #include "AI/EnemyAILog.h"
 
 #include "Blueprint/AIBlueprintHelperLibrary.h"
+#include "Character/ProCharacterMovementComponent.h"
 #include "Components/GSCCoreComponent.h"
 #include "Components/WidgetComponent.h"
 
@@ -17,7 +20,8 @@
 #include "Kismet/GameplayStatics.h"
 
 
-AEnemyAIBase::AEnemyAIBase()
+AEnemyAIBase::AEnemyAIBase(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer.SetDefaultSubobjectClass<UProCharacterMovementComponent>(ACharacter::CharacterMovementComponentName))
 {
 	// 매 프레임 Tick 함수 호출 활성화
 	PrimaryActorTick.bCanEverTick = true;
@@ -42,9 +46,28 @@ void AEnemyAIBase::BeginPlay()
 
 	EnemyAIController = Cast<AEnemyAIController>(UAIBlueprintHelperLibrary::GetAIController(this));
 
+	// 전술 영향력 맵의 좀비 밀집도 레이어에 반영
+	if (UTacticalInfluenceSubsystem* InfluenceMap = UWorld::GetSubsystem<UTacticalInfluenceSubsystem>(GetWorld()))
+		InfluenceMap->RegisterAgent(this);
+
+	// 밀집 구간 국소 회피(분리 + 충돌 예상 회피)에 참여
+	if (UCrowdSeparationSubsystem* CrowdSeparation = UWorld::GetSubsystem<UCrowdSeparationSubsystem>(GetWorld()))
+		CrowdSeparation->RegisterAgent(this);
+
 	// 블루프린트에서 Health Widget 설정 여부 확인 (필요 시 추가 처리)
 }
 
+void AEnemyAIBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UTacticalInfluenceSubsystem* InfluenceMap = UWorld::GetSubsystem<UTacticalInfluenceSubsystem>(GetWorld()))
+		InfluenceMap->UnregisterAgent(this);
+
+	if (UCrowdSeparationSubsystem* CrowdSeparation = UWorld::GetSubsystem<UCrowdSeparationSubsystem>(GetWorld()))
+		CrowdSeparation->UnregisterAgent(this);
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void AEnemyAIBase::OnAbilityEndedCallback(const UGameplayAbility* EndedAbility)
 {
 	if (!EndedAbility)
@@ -14,6 +14,7 @@
 #include "ShooterPro/Public/AI/EnemyAILog.h"
 
 #include "AI/Components/ProAIBehaviorsComponent.h"
+#include "AI/Subsystems/TacticalInfluenceSubsystem.h"
 #include "AI/Utility/EnemyAIBluePrintFunctionLibrary.h"
 
 
@@ -276,6 +277,15 @@ void AEnemyAIController::OnPerceptionUpdated(const TArray<AActor*>& UpdatedActor
 
 			// 새로운 자극 또는 감지 상태의 변화가 있을 때, DetectionInfo를 추가 또는 업데이트합니다.
 			DetectionInfoManager->AddOrUpdateDetection(GetPawn(), UpdatedActor, SenseType, Stimulus, CurrentTime);
+
+			// 들은 소리는 전술 영향력 맵의 소음 레이어에도 보고 (수색 위치 선정에 사용)
+			if (SenseType == EAISense::Hearing && Stimulus.WasSuccessfullySensed())
+			{
+				if (UTacticalInfluenceSubsystem* InfluenceMap = UWorld::GetSubsystem<UTacticalInfluenceSubsystem>(GetWorld()))
+				{
+					InfluenceMap->ReportNoise(Stimulus.StimulusLocation, Stimulus.Strength);
+				}
+			}
 		}
 	}
 }
@@ -0,0 +1,7 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "AI/Interfaces/Interface_PooledActor.h"
+
+
+// Add default functionality here for any IInterface_PooledActor functions that are not pure virtual.
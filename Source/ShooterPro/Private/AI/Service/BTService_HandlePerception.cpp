@@ -39,7 +39,8 @@ void UBTService_HandlePerception::TickNode(UBehaviorTreeComponent& OwnerComp, ui
 	// Tick마다 Check (만약 포인터 만료/Invalid 되었다면 다시 캐스팅 필요할 수도)
 	if (AEnemyAIController* EnemyAIController = CachedController.Get())
 	{
-		EnemyAIController->UpdatePerception(Interval);
+		// LOD로 간격이 늘어날 수 있으므로 Interval 대신 실제 누적 시간을 넘긴다
+		EnemyAIController->UpdatePerception(DeltaSeconds);
 	}
 }
 
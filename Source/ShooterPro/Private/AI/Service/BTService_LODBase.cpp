@@ -0,0 +1,13 @@
+#include "AI/Service/BTService_LODBase.h"
+
+#include "AIController.h"
+#include "AI_Spawner/AIOptimizerComponent.h"
+#include "BehaviorTree/BehaviorTreeComponent.h"
+
+
+void UBTService_LODBase::ScheduleNextTick(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
+{
+	const float IntervalScale = UAIOptimizerComponent::GetServiceIntervalScale(OwnerComp.GetAIOwner());
+	const float NextTickTime = FMath::FRandRange(FMath::Max(0.0f, Interval - RandomDeviation), (Interval + RandomDeviation)) * IntervalScale;
+	SetNextTickTime(NodeMemory, NextTickTime);
+}
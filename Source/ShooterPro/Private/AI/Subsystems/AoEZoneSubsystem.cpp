@@ -0,0 +1,237 @@
+#include "AI/Subsystems/AoEZoneSubsystem.h"
+
+#include "AbilitySystemComponent.h"
+#include "AbilitySystemGlobals.h"
+#include "EngineUtils.h"
+#include "GameplayEffect.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+
+DEFINE_STAT(STAT_ProEffects_AoEZones);
+DEFINE_STAT(STAT_ProEffects_AoEIndexedPawns);
+DEFINE_STAT(STAT_ProEffects_AoEApplications);
+
+
+bool UAoEZoneSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAoEZoneSubsystem::Deinitialize()
+{
+	Zones.Empty();
+	PawnLocations.Empty();
+	PawnASCs.Empty();
+	SortedPawns.Empty();
+	CellRanges.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UAoEZoneSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAoEZoneSubsystem, STATGROUP_Tickables);
+}
+
+void UAoEZoneSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	// 펄스 사이 시간은 누적해서 프레임이 튀어도 빈도를 유지 (한 프레임에 최대 한 번)
+	PulseAccumulator += DeltaTime;
+	const float PulseInterval = 1.0f / FMath::Max(PulseRate, 0.1f);
+	if (PulseAccumulator < PulseInterval)
+		return;
+
+	PulseAccumulator = FMath::Min(PulseAccumulator - PulseInterval, PulseInterval);
+	Pulse();
+}
+
+FProAoEZoneHandle UAoEZoneSubsystem::AddZone(const FProAoEZoneParams& Params, FVector Center, UObject* SourceObject, UAbilitySystemComponent* SourceASC)
+{
+	FProAoEZoneHandle Handle;
+	if (!Params.EffectClass || Params.Radius <= 0.0f)
+		return Handle;
+
+	const double Now = GetWorld()->GetTimeSeconds();
+
+	Handle.Id = NextZoneId++;
+	FZone& Zone = Zones.Add(Handle.Id);
+	Zone.Params = Params;
+	Zone.Center = Center;
+	Zone.EndTime = Params.Duration > 0.0f ? Now + Params.Duration : 0.0;
+	Zone.NextDamageTime = Now;
+	Zone.SourceObject = SourceObject;
+	Zone.SourceASC = SourceASC;
+
+	return Handle;
+}
+
+void UAoEZoneSubsystem::RemoveZone(FProAoEZoneHandle& Handle)
+{
+	if (Handle.IsValid())
+	{
+		Zones.Remove(Handle.Id);
+		Handle.Invalidate();
+	}
+}
+
+void UAoEZoneSubsystem::Pulse()
+{
+	const double Now = GetWorld()->GetTimeSeconds();
+
+	RemoveExpiredZones(Now);
+	SET_DWORD_STAT(STAT_ProEffects_AoEZones, Zones.Num());
+	if (Zones.Num() == 0)
+		return;
+
+	BuildPawnIndex();
+	SET_DWORD_STAT(STAT_ProEffects_AoEIndexedPawns, PawnLocations.Num());
+
+	UProEffectSpecCacheSubsystem* SpecCache = GetWorld()->GetSubsystem<UProEffectSpecCacheSubsystem>();
+
+	int32 NumApplications = 0;
+	TSet<TObjectKey<UAbilitySystemComponent>> NowInside;
+	for (TPair<int32, FZone>& Pair : Zones)
+	{
+		FZone& Zone = Pair.Value;
+
+		// 주기 적용 장판은 때가 안 됐으면 질의도 생략
+		const bool bPeriodic = Zone.Params.DamageInterval > 0.0f;
+		if (bPeriodic && Now < Zone.NextDamageTime)
+			continue;
+
+		QueryPawns(Zone.Center, Zone.Params.Radius, QueryScratch);
+
+		NowInside.Reset();
+		for (const int32 PawnIndex : QueryScratch)
+		{
+			UAbilitySystemComponent* TargetASC = PawnASCs[PawnIndex].Get();
+			if (!TargetASC)
+				continue;
+
+			if (!bPeriodic)
+			{
+				// 진입 시 한 번: 지난 펄스에 없던 대상에게만
+				const TObjectKey<UAbilitySystemComponent> TargetKey(TargetASC);
+				NowInside.Add(TargetKey);
+				if (Zone.InsideTargets.Contains(TargetKey))
+					continue;
+			}
+
+			FProEffectApplication Application;
+			Application.SourceASC = Zone.SourceASC.IsValid() ? Zone.SourceASC.Get() : TargetASC;
+			Application.TargetASC = TargetASC;
+			Application.EffectClass = Zone.Params.EffectClass;
+			Application.Level = Zone.Params.EffectLevel;
+			Application.SourceObject = Zone.SourceObject;
+
+			if (SpecCache)
+				SpecCache->Enqueue(MoveTemp(Application));
+			else
+				UProEffectSpecCacheSubsystem::Apply(this, MoveTemp(Application));
+
+			++NumApplications;
+		}
+
+		if (bPeriodic)
+		{
+			Zone.NextDamageTime += Zone.Params.DamageInterval;
+
+			// 오래 멈춰 있었다면 밀린 만큼 몰아서 주지 않는다
+			if (Zone.NextDamageTime < Now)
+				Zone.NextDamageTime = Now + Zone.Params.DamageInterval;
+		}
+		else
+		{
+			Swap(Zone.InsideTargets, NowInside);
+		}
+	}
+
+	SET_DWORD_STAT(STAT_ProEffects_AoEApplications, NumApplications);
+}
+
+void UAoEZoneSubsystem::RemoveExpiredZones(double Now)
+{
+	for (auto It = Zones.CreateIterator(); It; ++It)
+	{
+		if (It->Value.EndTime > 0.0 && Now >= It->Value.EndTime)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void UAoEZoneSubsystem::BuildPawnIndex()
+{
+	PawnLocations.Reset();
+	PawnASCs.Reset();
+	SortedPawns.Reset();
+	CellRanges.Reset();
+
+	const float SafeCellSize = FMath::Max(CellSize, 10.0f);
+
+	// ASC가 있는 폰만 인덱스에 넣는다 (정적 지형/투사체 등은 물리 질의 없이 제외)
+	for (TActorIterator<APawn> It(GetWorld()); It; ++It)
+	{
+		APawn* Pawn = *It;
+		if (!IsValid(Pawn))
+			continue;
+
+		UAbilitySystemComponent* ASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(Pawn);
+		if (!ASC)
+			continue;
+
+		const FVector Location = Pawn->GetActorLocation();
+		const int32 Index = PawnLocations.Add(Location);
+		PawnASCs.Add(ASC);
+
+		const int32 CellX = FMath::FloorToInt32(Location.X / SafeCellSize);
+		const int32 CellY = FMath::FloorToInt32(Location.Y / SafeCellSize);
+		SortedPawns.Emplace(GetCellKey(CellX, CellY), Index);
+	}
+
+	SortedPawns.Sort([](const TPair<int64, int32>& A, const TPair<int64, int32>& B)
+	{
+		return A.Key < B.Key;
+	});
+
+	for (int32 Sorted = 0; Sorted < SortedPawns.Num(); ++Sorted)
+	{
+		TPair<int32, int32>& Range = CellRanges.FindOrAdd(SortedPawns[Sorted].Key, TPair<int32, int32>(Sorted, 0));
+		++Range.Value;
+	}
+}
+
+void UAoEZoneSubsystem::QueryPawns(const FVector& Center, float Radius, TArray<int32>& OutPawns) const
+{
+	OutPawns.Reset();
+
+	const float SafeCellSize = FMath::Max(CellSize, 10.0f);
+	const int32 MinCellX = FMath::FloorToInt32((Center.X - Radius) / SafeCellSize);
+	const int32 MaxCellX = FMath::FloorToInt32((Center.X + Radius) / SafeCellSize);
+	const int32 MinCellY = FMath::FloorToInt32((Center.Y - Radius) / SafeCellSize);
+	const int32 MaxCellY = FMath::FloorToInt32((Center.Y + Radius) / SafeCellSize);
+	const double RadiusSquared = FMath::Square(Radius);
+
+	for (int32 CellY = MinCellY; CellY <= MaxCellY; ++CellY)
+	{
+		for (int32 CellX = MinCellX; CellX <= MaxCellX; ++CellX)
+		{
+			const TPair<int32, int32>* Range = CellRanges.Find(GetCellKey(CellX, CellY));
+			if (!Range)
+				continue;
+
+			for (int32 Sorted = Range->Key; Sorted < Range->Key + Range->Value; ++Sorted)
+			{
+				const int32 PawnIndex = SortedPawns[Sorted].Value;
+				const FVector& Location = PawnLocations[PawnIndex];
+				if (FVector2D::DistSquared(FVector2D(Location), FVector2D(Center)) <= RadiusSquared
+					&& FMath::Abs(Location.Z - Center.Z) <= HalfHeight)
+				{
+					OutPawns.Add(PawnIndex);
+				}
+			}
+		}
+	}
+}
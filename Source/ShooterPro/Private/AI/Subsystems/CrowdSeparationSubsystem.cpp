@@ -0,0 +1,257 @@
+#include "AI/Subsystems/CrowdSeparationSubsystem.h"
+
+#include "Async/ParallelFor.h"
+#include "Components/CapsuleComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/Pawn.h"
+
+DEFINE_STAT(STAT_ProCrowd_Agents);
+DEFINE_STAT(STAT_ProCrowd_PairInteractions);
+DEFINE_STAT(STAT_ProCrowd_PenetratingPairs);
+DEFINE_STAT(STAT_ProCrowd_Depenetrations);
+
+
+bool UCrowdSeparationSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UCrowdSeparationSubsystem::Deinitialize()
+{
+	// 워커 스레드가 this를 참조하고 있으므로 반드시 끝날 때까지 대기
+	PendingJob.Wait();
+
+	Agents.Empty();
+	SnapshotAgents.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UCrowdSeparationSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UCrowdSeparationSubsystem, STATGROUP_Tickables);
+}
+
+void UCrowdSeparationSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	// 이전 계산이 아직 진행 중이면 이번 프레임은 건너뜀 (게임 스레드는 기다리지 않는다)
+	if (PendingJob.IsValid() && !PendingJob.IsCompleted())
+		return;
+
+	// 1) 지난 프레임 결과 반영
+	if (PendingJob.IsValid())
+	{
+		ApplySteering();
+		PendingJob = UE::Tasks::FTask();
+	}
+
+	SET_DWORD_STAT(STAT_ProCrowd_Agents, Agents.Num());
+	SET_DWORD_STAT(STAT_ProCrowd_PairInteractions, LastPairInteractions);
+	SET_DWORD_STAT(STAT_ProCrowd_PenetratingPairs, LastPenetratingPairs);
+
+	// 2) 새 스냅샷으로 다음 계산 시작
+	if (Agents.Num() > 1)
+	{
+		BuildSnapshot();
+		LaunchJob();
+	}
+}
+
+void UCrowdSeparationSubsystem::RegisterAgent(APawn* Agent)
+{
+	if (Agent)
+		Agents.AddUnique(Agent);
+}
+
+void UCrowdSeparationSubsystem::UnregisterAgent(APawn* Agent)
+{
+	// 스냅샷은 약참조로 들고 있으므로 계산 중에 빠져도 안전하다
+	Agents.RemoveSwap(Agent, EAllowShrinking::No);
+}
+
+void UCrowdSeparationSubsystem::ApplySteering()
+{
+	LastPairInteractions = JobPairInteractions;
+	LastPenetratingPairs = JobPenetratingPairs;
+
+	for (int32 Index = 0; Index < SnapshotAgents.Num(); ++Index)
+	{
+		const FVector2D& Direction = Steering[Index];
+		if (Direction.IsNearlyZero())
+			continue;
+
+		APawn* Agent = SnapshotAgents[Index].Get();
+		if (!Agent || Agent->IsPendingKillPending())
+			continue;
+
+		// 경로 추종(RequestDirectMove)의 요청 가속도에 더해지는 입력으로 넣어 경로는 유지하면서 옆으로 비켜서게 한다
+		Agent->AddMovementInput(FVector(Direction.X, Direction.Y, 0.0f), 1.0f);
+	}
+}
+
+void UCrowdSeparationSubsystem::BuildSnapshot()
+{
+	Agents.RemoveAllSwap([](const TWeakObjectPtr<APawn>& Agent)
+	{
+		return !Agent.IsValid();
+	}, EAllowShrinking::No);
+
+	SnapshotAgents.Reset();
+	Positions.Reset();
+	Velocities.Reset();
+	Radii.Reset();
+
+	for (const TWeakObjectPtr<APawn>& WeakAgent : Agents)
+	{
+		const APawn* Agent = WeakAgent.Get();
+
+		float Radius = 34.0f;
+		if (const ACharacter* Character = Cast<ACharacter>(Agent))
+		{
+			Radius = Character->GetCapsuleComponent()->GetScaledCapsuleRadius();
+		}
+
+		SnapshotAgents.Add(WeakAgent);
+		Positions.Add(FVector2D(Agent->GetActorLocation()));
+		Velocities.Add(FVector2D(Agent->GetVelocity()));
+		Radii.Add(Radius);
+	}
+
+	Steering.SetNumZeroed(SnapshotAgents.Num());
+}
+
+void UCrowdSeparationSubsystem::LaunchJob()
+{
+	PendingJob = UE::Tasks::Launch(UE_SOURCE_LOCATION, [this]()
+	{
+		ComputeSteering();
+	});
+}
+
+void UCrowdSeparationSubsystem::ComputeSteering()
+{
+	const int32 NumAgents = Positions.Num();
+	const float CellSize = FMath::Max(NeighborRadius, 10.0f);
+	const float NeighborRadiusSquared = FMath::Square(CellSize);
+
+	auto GetCellKey = [](int32 CellX, int32 CellY)
+	{
+		return (static_cast<int64>(CellX) << 32) | static_cast<uint32>(CellY);
+	};
+
+	// 1) 공간 해시: 셀 키 순으로 정렬된 인덱스 + 셀별 [시작, 개수]
+	TArray<TPair<int64, int32>> SortedAgents;
+	SortedAgents.Reserve(NumAgents);
+	for (int32 Index = 0; Index < NumAgents; ++Index)
+	{
+		const int32 CellX = FMath::FloorToInt32(Positions[Index].X / CellSize);
+		const int32 CellY = FMath::FloorToInt32(Positions[Index].Y / CellSize);
+		SortedAgents.Emplace(GetCellKey(CellX, CellY), Index);
+	}
+	SortedAgents.Sort([](const TPair<int64, int32>& A, const TPair<int64, int32>& B)
+	{
+		return A.Key < B.Key;
+	});
+
+	TMap<int64, TPair<int32, int32>> CellRanges;
+	CellRanges.Reserve(NumAgents);
+	for (int32 Sorted = 0; Sorted < SortedAgents.Num(); ++Sorted)
+	{
+		TPair<int32, int32>& Range = CellRanges.FindOrAdd(SortedAgents[Sorted].Key, TPair<int32, int32>(Sorted, 0));
+		++Range.Value;
+	}
+
+	// 2) 에이전트별 분리 + 충돌 예상 회피
+	std::atomic<int32> PairInteractions = 0;
+	std::atomic<int32> PenetratingPairs = 0;
+
+	ParallelFor(NumAgents, [&](int32 Index)
+	{
+		const FVector2D Position = Positions[Index];
+		const FVector2D Velocity = Velocities[Index];
+		const int32 CellX = FMath::FloorToInt32(Position.X / CellSize);
+		const int32 CellY = FMath::FloorToInt32(Position.Y / CellSize);
+
+		FVector2D Separation = FVector2D::ZeroVector;
+		FVector2D Avoidance = FVector2D::ZeroVector;
+		int32 LocalPairs = 0;
+		int32 LocalPenetrating = 0;
+
+		for (int32 OffsetY = -1; OffsetY <= 1; ++OffsetY)
+		{
+			for (int32 OffsetX = -1; OffsetX <= 1; ++OffsetX)
+			{
+				const TPair<int32, int32>* Range = CellRanges.Find(GetCellKey(CellX + OffsetX, CellY + OffsetY));
+				if (!Range)
+					continue;
+
+				for (int32 Sorted = Range->Key; Sorted < Range->Key + Range->Value; ++Sorted)
+				{
+					const int32 Other = SortedAgents[Sorted].Value;
+					if (Other == Index)
+						continue;
+
+					const FVector2D Delta = Position - Positions[Other];
+					const double DistSquared = Delta.SizeSquared();
+					if (DistSquared > NeighborRadiusSquared)
+						continue;
+
+					// 쌍 통계는 한 쪽에서만 센다
+					const bool bCountPair = Index < Other;
+					if (bCountPair)
+						++LocalPairs;
+
+					const float ContactDistance = Radii[Index] + Radii[Other];
+					const float PersonalDistance = ContactDistance + SeparationPadding;
+					const float Dist = FMath::Sqrt(static_cast<float>(DistSquared));
+
+					// 분리: 개인 거리 안으로 들어온 만큼 선형으로 밀어냄
+					if (Dist < PersonalDistance)
+					{
+						const FVector2D Away = Dist > UE_KINDA_SMALL_NUMBER ? Delta / Dist : FVector2D(Index < Other ? 1.0 : -1.0, 0.0);
+						Separation += Away * (1.0f - Dist / PersonalDistance);
+
+						if (bCountPair && Dist < ContactDistance)
+							++LocalPenetrating;
+					}
+
+					// 속도 장애물: 상대 속도로 가장 가까워지는 시각이 TimeHorizon 안이고 그때 개인 거리를 침범하면 비켜섬
+					const FVector2D RelativeVelocity = Velocity - Velocities[Other];
+					const double RelativeSpeedSquared = RelativeVelocity.SizeSquared();
+					if (RelativeSpeedSquared < UE_KINDA_SMALL_NUMBER)
+						continue;
+
+					const float TimeToClosest = static_cast<float>(-FVector2D::DotProduct(Delta, RelativeVelocity) / RelativeSpeedSquared);
+					if (TimeToClosest <= 0.0f || TimeToClosest >= TimeHorizon)
+						continue;
+
+					const FVector2D ClosestDelta = Delta + RelativeVelocity * TimeToClosest;
+					const double ClosestDistSquared = ClosestDelta.SizeSquared();
+					if (ClosestDistSquared >= FMath::Square(PersonalDistance))
+						continue;
+
+					// 정면으로 마주 오는 경우에는 진행 방향의 오른쪽으로 비켜 서로 엇갈리게 한다
+					const FVector2D Dodge = ClosestDistSquared > UE_KINDA_SMALL_NUMBER
+						                        ? ClosestDelta.GetSafeNormal()
+						                        : FVector2D(-RelativeVelocity.Y, RelativeVelocity.X).GetSafeNormal();
+					Avoidance += Dodge * (1.0f - TimeToClosest / TimeHorizon);
+				}
+			}
+		}
+
+		FVector2D Result = Separation * SeparationWeight + Avoidance * AvoidanceWeight;
+		Result = Result.GetClampedToMaxSize(1.0) * SteeringStrength;
+		Steering[Index] = Result;
+
+		if (LocalPairs > 0)
+			PairInteractions.fetch_add(LocalPairs, std::memory_order_relaxed);
+		if (LocalPenetrating > 0)
+			PenetratingPairs.fetch_add(LocalPenetrating, std::memory_order_relaxed);
+	});
+
+	JobPairInteractions = PairInteractions.load();
+	JobPenetratingPairs = PenetratingPairs.load();
+}
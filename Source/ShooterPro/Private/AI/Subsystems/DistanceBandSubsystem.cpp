@@ -0,0 +1,148 @@
+#include "AI/Subsystems/DistanceBandSubsystem.h"
+
+#include "GameFramework/Actor.h"
+
+
+bool UDistanceBandSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UDistanceBandSubsystem::Deinitialize()
+{
+	SelfActors.Empty();
+	TargetActors.Empty();
+	Thresholds.Empty();
+	Hysteresises.Empty();
+	BandInside.Empty();
+	BandActive.Empty();
+	Callbacks.Empty();
+	FreeSlots.Empty();
+	PendingCrossings.Empty();
+	NumActiveBands = 0;
+
+	Super::Deinitialize();
+}
+
+TStatId UDistanceBandSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UDistanceBandSubsystem, STATGROUP_Tickables);
+}
+
+void UDistanceBandSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	PendingCrossings.Reset();
+
+	// 1) 모든 밴드의 제곱 거리를 한 번에 평가
+	const int32 NumSlots = BandActive.Num();
+	for (int32 Handle = 0; Handle < NumSlots; ++Handle)
+	{
+		if (!BandActive[Handle])
+			continue;
+
+		const AActor* SelfActor = SelfActors[Handle].Get();
+		const AActor* TargetActor = TargetActors[Handle].Get();
+
+		// 액터가 사라졌다면 '밖'으로 간주
+		bool bNowInside = false;
+		if (SelfActor && TargetActor)
+		{
+			const float DistSquared = FVector::DistSquared(SelfActor->GetActorLocation(), TargetActor->GetActorLocation());
+			bNowInside = EvaluateBand(DistSquared, Thresholds[Handle], Hysteresises[Handle], BandInside[Handle]);
+		}
+
+		if (bNowInside != BandInside[Handle])
+		{
+			BandInside[Handle] = bNowInside;
+			PendingCrossings.Emplace(Handle, bNowInside);
+		}
+	}
+
+	// 2) 경계를 넘은 밴드만 통지 (콜백 안에서 등록/해제가 일어나도 안전하도록 루프 밖에서 호출)
+	for (const TPair<int32, bool>& Crossing : PendingCrossings)
+	{
+		if (IsValidBand(Crossing.Key))
+		{
+			Callbacks[Crossing.Key].ExecuteIfBound(Crossing.Value);
+		}
+	}
+}
+
+int32 UDistanceBandSubsystem::RegisterBand(AActor* SelfActor, AActor* TargetActor, float Threshold, float Hysteresis, FOnDistanceBandChanged&& Callback, bool& OutbInside)
+{
+	int32 Handle;
+	if (FreeSlots.Num() > 0)
+	{
+		Handle = FreeSlots.Pop(EAllowShrinking::No);
+	}
+	else
+	{
+		Handle = BandActive.Num();
+		SelfActors.AddDefaulted();
+		TargetActors.AddDefaulted();
+		Thresholds.AddZeroed();
+		Hysteresises.AddZeroed();
+		BandInside.Add(false);
+		BandActive.Add(false);
+		Callbacks.AddDefaulted();
+	}
+
+	SelfActors[Handle] = SelfActor;
+	TargetActors[Handle] = TargetActor;
+	Thresholds[Handle] = Threshold;
+	Hysteresises[Handle] = FMath::Max(Hysteresis, 0.0f);
+	BandActive[Handle] = true;
+	Callbacks[Handle] = MoveTemp(Callback);
+	BandInside[Handle] = ComputeInside(Handle, false);
+
+	++NumActiveBands;
+
+	OutbInside = BandInside[Handle];
+	return Handle;
+}
+
+void UDistanceBandSubsystem::UnregisterBand(int32& Handle)
+{
+	if (!IsValidBand(Handle))
+	{
+		Handle = InvalidHandle;
+		return;
+	}
+
+	SelfActors[Handle].Reset();
+	TargetActors[Handle].Reset();
+	Callbacks[Handle].Unbind();
+	BandActive[Handle] = false;
+	BandInside[Handle] = false;
+	FreeSlots.Add(Handle);
+
+	--NumActiveBands;
+	Handle = InvalidHandle;
+}
+
+bool UDistanceBandSubsystem::UpdateBand(int32 Handle, AActor* TargetActor, float Threshold)
+{
+	if (!IsValidBand(Handle))
+		return false;
+
+	// 타겟이 바뀌면 히스테리시스 기준도 새로 시작
+	const bool bTargetChanged = TargetActors[Handle].Get() != TargetActor;
+	TargetActors[Handle] = TargetActor;
+	Thresholds[Handle] = Threshold;
+	BandInside[Handle] = ComputeInside(Handle, !bTargetChanged && BandInside[Handle]);
+
+	return BandInside[Handle];
+}
+
+bool UDistanceBandSubsystem::ComputeInside(int32 Handle, bool bWasInside) const
+{
+	const AActor* SelfActor = SelfActors[Handle].Get();
+	const AActor* TargetActor = TargetActors[Handle].Get();
+	if (!SelfActor || !TargetActor)
+		return false;
+
+	const float DistSquared = FVector::DistSquared(SelfActor->GetActorLocation(), TargetActor->GetActorLocation());
+	return EvaluateBand(DistSquared, Thresholds[Handle], Hysteresises[Handle], bWasInside);
+}
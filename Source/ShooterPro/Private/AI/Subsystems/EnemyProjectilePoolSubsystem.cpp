@@ -0,0 +1,187 @@
+#include "AI/Subsystems/EnemyProjectilePoolSubsystem.h"
+
+#include "AI/Interfaces/Interface_PooledActor.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+
+
+bool UEnemyProjectilePoolSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UEnemyProjectilePoolSubsystem::Deinitialize()
+{
+	// 액터는 월드와 함께 정리되므로 참조만 끊는다
+	Pools.Empty();
+	ActiveActors.Empty();
+	PooledActors.Empty();
+	ExpiredActors.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UEnemyProjectilePoolSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEnemyProjectilePoolSubsystem, STATGROUP_Tickables);
+}
+
+void UEnemyProjectilePoolSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	const double Now = GetWorld()->GetTimeSeconds();
+
+	// 반납 중에 맵이 바뀌므로 먼저 모아둔다
+	ExpiredActors.Reset();
+	for (const TPair<TObjectKey<AActor>, double>& Pair : ActiveActors)
+	{
+		// 외부에서 파괴된 액터도 함께 정리
+		if ((Pair.Value > 0.0 && Now >= Pair.Value) || !Pair.Key.ResolveObjectPtr())
+		{
+			ExpiredActors.Add(Pair.Key);
+		}
+	}
+
+	for (const TObjectKey<AActor>& Key : ExpiredActors)
+	{
+		if (AActor* Actor = Key.ResolveObjectPtr())
+		{
+			ReleaseActor(Actor);
+		}
+		else
+		{
+			ActiveActors.Remove(Key);
+		}
+	}
+}
+
+AActor* UEnemyProjectilePoolSubsystem::AcquireActor(TSubclassOf<AActor> ActorClass, const FTransform& Transform, AActor* NewOwner, APawn* NewInstigator)
+{
+	if (!*ActorClass)
+		return nullptr;
+
+	// 1) 대기 중인 액터 꺼내기
+	AActor* Actor = nullptr;
+	if (FEnemyPooledActorList* Pool = Pools.Find(ActorClass))
+	{
+		while (!Actor && Pool->FreeActors.Num() > 0)
+		{
+			Actor = Pool->FreeActors.Pop(EAllowShrinking::No);
+			if (!IsValid(Actor))
+				Actor = nullptr;
+		}
+	}
+
+	// 2) 없으면 새로 스폰
+	if (!Actor)
+	{
+		Actor = SpawnPooledActor(ActorClass);
+		if (!Actor)
+			return nullptr;
+	}
+
+	// 3) 배치 후 활성화
+	Actor->SetActorTransform(Transform, false, nullptr, ETeleportType::ResetPhysics);
+	Actor->SetOwner(NewOwner);
+	Actor->SetInstigator(NewInstigator);
+
+	float LifeSpan = 0.0f;
+	if (IInterface_PooledActor* PooledActor = Cast<IInterface_PooledActor>(Actor))
+	{
+		PooledActor->OnAcquiredFromPool();
+		LifeSpan = PooledActor->GetPooledLifeSpan();
+	}
+
+	ActiveActors.Add(TObjectKey<AActor>(Actor), LifeSpan > 0.0f ? GetWorld()->GetTimeSeconds() + LifeSpan : 0.0);
+
+	return Actor;
+}
+
+bool UEnemyProjectilePoolSubsystem::ReleaseActor(AActor* Actor)
+{
+	if (!Actor || ActiveActors.Remove(TObjectKey<AActor>(Actor)) == 0)
+		return false;
+
+	if (!IsValid(Actor))
+		return true;
+
+	if (IInterface_PooledActor* PooledActor = Cast<IInterface_PooledActor>(Actor))
+	{
+		PooledActor->OnReleasedToPool();
+	}
+
+	Actor->SetOwner(nullptr);
+	Actor->SetInstigator(nullptr);
+
+	Pools.FindOrAdd(Actor->GetClass()).FreeActors.Add(Actor);
+	return true;
+}
+
+void UEnemyProjectilePoolSubsystem::Prewarm(TSubclassOf<AActor> ActorClass, int32 Count)
+{
+	if (!*ActorClass || Count <= 0)
+		return;
+
+	while (Pools.FindOrAdd(ActorClass).FreeActors.Num() < Count)
+	{
+		AActor* Actor = SpawnPooledActor(ActorClass);
+		if (!Actor)
+			break;
+
+		Pools.FindOrAdd(ActorClass).FreeActors.Add(Actor);
+	}
+}
+
+void UEnemyProjectilePoolSubsystem::ReleaseOrDestroy(AActor* Actor)
+{
+	if (!Actor)
+		return;
+
+	UEnemyProjectilePoolSubsystem* PoolSubsystem = UWorld::GetSubsystem<UEnemyProjectilePoolSubsystem>(Actor->GetWorld());
+
+	// OnHit과 OnOverlapBegin이 한 번의 이동에서 모두 불리면 두 번째 호출은 이미 대기 중인 액터를 받는다
+	if (PoolSubsystem && PoolSubsystem->IsActorFree(Actor))
+		return;
+
+	if (!PoolSubsystem || !PoolSubsystem->ReleaseActor(Actor))
+	{
+		Actor->Destroy();
+	}
+}
+
+bool UEnemyProjectilePoolSubsystem::IsActorInUse(const AActor* Actor)
+{
+	if (!IsValid(Actor))
+		return false;
+
+	const UEnemyProjectilePoolSubsystem* PoolSubsystem = UWorld::GetSubsystem<UEnemyProjectilePoolSubsystem>(Actor->GetWorld());
+	return !PoolSubsystem || !PoolSubsystem->IsActorFree(Actor);
+}
+
+bool UEnemyProjectilePoolSubsystem::IsActorFree(const AActor* Actor) const
+{
+	// 풀이 만든 액터 중 사용 중이 아닌 것 (대기 목록을 훑지 않도록 해시 조회 두 번으로)
+	const TObjectKey<AActor> Key(Actor);
+	return Actor && PooledActors.Contains(Key) && !ActiveActors.Contains(Key);
+}
+
+AActor* UEnemyProjectilePoolSubsystem::SpawnPooledActor(TSubclassOf<AActor> ActorClass)
+{
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	AActor* Actor = GetWorld()->SpawnActor<AActor>(ActorClass, FTransform::Identity, SpawnParams);
+	if (!Actor)
+		return nullptr;
+
+	PooledActors.Add(TObjectKey<AActor>(Actor));
+
+	// 스폰 직후에는 대기 상태로 만든다 (활성화는 항상 OnAcquiredFromPool에서)
+	if (IInterface_PooledActor* PooledActor = Cast<IInterface_PooledActor>(Actor))
+	{
+		PooledActor->OnReleasedToPool();
+	}
+
+	return Actor;
+}
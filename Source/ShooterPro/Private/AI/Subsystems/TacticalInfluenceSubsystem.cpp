@@ -0,0 +1,302 @@
+#include "AI/Subsystems/TacticalInfluenceSubsystem.h"
+
+#include "Async/ParallelFor.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+
+
+bool UTacticalInfluenceSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UTacticalInfluenceSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	GridSize = FMath::Max(GridSize, 8);
+	RowsPerSlice = FMath::Clamp(RowsPerSlice, 1, GridSize);
+	CellSize = FMath::Max(CellSize, 10.0f);
+
+	const int32 NumCells = GridSize * GridSize;
+	for (FInfluenceGrid& Grid : Grids)
+	{
+		for (TArray<float>& Layer : Grid.Layers)
+		{
+			Layer.SetNumZeroed(NumCells);
+		}
+	}
+	Snapshot.AgentCounts.SetNumZeroed(NumCells);
+}
+
+void UTacticalInfluenceSubsystem::Deinitialize()
+{
+	// 워커 스레드가 this를 참조하고 있으므로 반드시 끝날 때까지 대기
+	PendingSlice.Wait();
+
+	Agents.Empty();
+	NoiseEvents.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UTacticalInfluenceSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UTacticalInfluenceSubsystem, STATGROUP_Tickables);
+}
+
+void UTacticalInfluenceSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	// 이전 조각이 아직 계산 중이면 이번 프레임은 건너뜀 (게임 스레드는 절대 기다리지 않는다)
+	if (PendingSlice.IsValid() && !PendingSlice.IsCompleted())
+		return;
+
+	// 한 바퀴가 끝났으면 버퍼 교체 후 새 스냅샷으로 다음 바퀴 시작
+	if (NextRow >= GridSize || !PendingSlice.IsValid())
+	{
+		if (PendingSlice.IsValid())
+		{
+			FrontIndex = 1 - FrontIndex;
+			bHasValidFront = true;
+		}
+
+		BuildSnapshot();
+		NextRow = 0;
+	}
+
+	LaunchSlice();
+}
+
+void UTacticalInfluenceSubsystem::BuildSnapshot()
+{
+	UWorld* World = GetWorld();
+	const double Now = World ? World->GetTimeSeconds() : 0.0;
+
+	// 1) 플레이어
+	Snapshot.PlayerLocations.Reset();
+	Snapshot.PlayerForwards.Reset();
+	if (World)
+	{
+		for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+		{
+			const APlayerController* PC = It->Get();
+			const APawn* PlayerPawn = PC ? PC->GetPawn() : nullptr;
+			if (!PlayerPawn)
+				continue;
+
+			Snapshot.PlayerLocations.Add(FVector2D(PlayerPawn->GetActorLocation()));
+			Snapshot.PlayerForwards.Add(FVector2D(PC->GetControlRotation().Vector()).GetSafeNormal());
+		}
+	}
+
+	// 2) 맵 중심은 플레이어들의 평균 위치 (플레이어가 없으면 이전 위치 유지)
+	if (Snapshot.PlayerLocations.Num() > 0)
+	{
+		FVector2D Center = FVector2D::ZeroVector;
+		for (const FVector2D& PlayerLocation : Snapshot.PlayerLocations)
+		{
+			Center += PlayerLocation;
+		}
+		Center /= Snapshot.PlayerLocations.Num();
+
+		const FVector2D SnappedCenter(FMath::FloorToDouble(Center.X / CellSize), FMath::FloorToDouble(Center.Y / CellSize));
+		Snapshot.Origin = (SnappedCenter - FVector2D(GridSize / 2)) * CellSize;
+	}
+	Grids[1 - FrontIndex].Origin = Snapshot.Origin;
+
+	// 3) 소음 (만료된 것은 제거, 남은 것은 경과 시간에 따라 감쇠)
+	Snapshot.NoiseLocations.Reset();
+	Snapshot.NoiseStrengths.Reset();
+	NoiseEvents.RemoveAllSwap([Now, this](const FNoiseEvent& Event)
+	{
+		return Now - Event.Time >= NoiseLifetime;
+	}, EAllowShrinking::No);
+	for (const FNoiseEvent& Event : NoiseEvents)
+	{
+		const float Age = static_cast<float>(Now - Event.Time);
+		Snapshot.NoiseLocations.Add(Event.Location);
+		Snapshot.NoiseStrengths.Add(Event.Loudness * (1.0f - Age / NoiseLifetime));
+	}
+
+	// 4) 좀비를 셀 단위로 집계 (밀집도는 워커에서 주변 셀과 함께 평균)
+	FMemory::Memzero(Snapshot.AgentCounts.GetData(), Snapshot.AgentCounts.Num() * sizeof(uint16));
+	Agents.RemoveAllSwap([](const TWeakObjectPtr<AActor>& Agent) { return !Agent.IsValid(); }, EAllowShrinking::No);
+	for (const TWeakObjectPtr<AActor>& Agent : Agents)
+	{
+		const FVector2D Local = (FVector2D(Agent->GetActorLocation()) - Snapshot.Origin) / CellSize;
+		const int32 X = FMath::FloorToInt32(Local.X);
+		const int32 Y = FMath::FloorToInt32(Local.Y);
+		if (X < 0 || Y < 0 || X >= GridSize || Y >= GridSize)
+			continue;
+
+		uint16& Count = Snapshot.AgentCounts[Y * GridSize + X];
+		Count = static_cast<uint16>(FMath::Min<int32>(Count + 1, MAX_uint16));
+	}
+}
+
+void UTacticalInfluenceSubsystem::LaunchSlice()
+{
+	const int32 StartRow = NextRow;
+	const int32 NumRows = FMath::Min(RowsPerSlice, GridSize - StartRow);
+	NextRow = StartRow + NumRows;
+
+	PendingSlice = UE::Tasks::Launch(UE_SOURCE_LOCATION, [this, StartRow, NumRows]()
+	{
+		ParallelFor(NumRows, [this, StartRow](int32 RowOffset)
+		{
+			ComputeRow(StartRow + RowOffset);
+		});
+	});
+}
+
+void UTacticalInfluenceSubsystem::ComputeRow(int32 Row)
+{
+	FInfluenceGrid& Back = Grids[1 - FrontIndex];
+	float* ThreatRow = Back.Layers[static_cast<int32>(ETacticalInfluenceLayer::Threat)].GetData() + Row * GridSize;
+	float* PresenceRow = Back.Layers[static_cast<int32>(ETacticalInfluenceLayer::PlayerPresence)].GetData() + Row * GridSize;
+	float* NoiseRow = Back.Layers[static_cast<int32>(ETacticalInfluenceLayer::Noise)].GetData() + Row * GridSize;
+	float* DensityRow = Back.Layers[static_cast<int32>(ETacticalInfluenceLayer::ZombieDensity)].GetData() + Row * GridSize;
+
+	const float InvTwoSigmaSquared = 1.0f / (2.0f * FMath::Square(PresenceRadius));
+	const float ThreatRangeSquared = FMath::Square(ThreatRange);
+	const float NoiseRadiusSquared = FMath::Square(NoiseRadius);
+	const int32 NumPlayers = Snapshot.PlayerLocations.Num();
+	const int32 NumNoises = Snapshot.NoiseLocations.Num();
+
+	for (int32 Column = 0; Column < GridSize; ++Column)
+	{
+		const FVector2D CellCenter = Snapshot.Origin + FVector2D(Column + 0.5, Row + 0.5) * CellSize;
+
+		// 플레이어 존재감 (가우시안), 사선 위협 (전방 코사인^4 * 거리 감쇠)
+		float Presence = 0.0f;
+		float Threat = 0.0f;
+		for (int32 PlayerIndex = 0; PlayerIndex < NumPlayers; ++PlayerIndex)
+		{
+			const FVector2D ToCell = CellCenter - Snapshot.PlayerLocations[PlayerIndex];
+			const float DistSquared = static_cast<float>(ToCell.SizeSquared());
+			Presence += FMath::Exp(-DistSquared * InvTwoSigmaSquared);
+
+			if (DistSquared < ThreatRangeSquared && DistSquared > KINDA_SMALL_NUMBER)
+			{
+				const float Dist = FMath::Sqrt(DistSquared);
+				const float Facing = static_cast<float>((ToCell / Dist) | Snapshot.PlayerForwards[PlayerIndex]);
+				if (Facing > 0.0f)
+				{
+					Threat += FMath::Square(FMath::Square(Facing)) * (1.0f - Dist / ThreatRange);
+				}
+			}
+		}
+
+		// 최근 소음 (선형 감쇠)
+		float Noise = 0.0f;
+		for (int32 NoiseIndex = 0; NoiseIndex < NumNoises; ++NoiseIndex)
+		{
+			const float DistSquared = static_cast<float>(FVector2D::DistSquared(CellCenter, Snapshot.NoiseLocations[NoiseIndex]));
+			if (DistSquared < NoiseRadiusSquared)
+			{
+				Noise += Snapshot.NoiseStrengths[NoiseIndex] * (1.0f - FMath::Sqrt(DistSquared) / NoiseRadius);
+			}
+		}
+
+		// 좀비 밀집도 (3x3 셀 평균)
+		int32 AgentSum = 0;
+		for (int32 Y = FMath::Max(Row - 1, 0); Y <= FMath::Min(Row + 1, GridSize - 1); ++Y)
+		{
+			for (int32 X = FMath::Max(Column - 1, 0); X <= FMath::Min(Column + 1, GridSize - 1); ++X)
+			{
+				AgentSum += Snapshot.AgentCounts[Y * GridSize + X];
+			}
+		}
+
+		ThreatRow[Column] = Threat;
+		PresenceRow[Column] = Presence;
+		NoiseRow[Column] = Noise;
+		DensityRow[Column] = AgentSum / 9.0f;
+	}
+}
+
+void UTacticalInfluenceSubsystem::RegisterAgent(AActor* Agent)
+{
+	if (Agent)
+	{
+		Agents.AddUnique(Agent);
+	}
+}
+
+void UTacticalInfluenceSubsystem::UnregisterAgent(AActor* Agent)
+{
+	Agents.RemoveSingleSwap(Agent, EAllowShrinking::No);
+}
+
+void UTacticalInfluenceSubsystem::ReportNoise(const FVector& Location, float Loudness)
+{
+	const UWorld* World = GetWorld();
+	if (!World || Loudness <= 0.0f)
+		return;
+
+	const double Now = World->GetTimeSeconds();
+	const FVector2D Location2D(Location);
+
+	// 같은 소리를 여러 AI가 동시에 보고하는 경우가 많으므로 가까운 최근 소음은 합친다
+	for (FNoiseEvent& Event : NoiseEvents)
+	{
+		if (Now - Event.Time < 0.5 && FVector2D::DistSquared(Event.Location, Location2D) < FMath::Square(CellSize))
+		{
+			Event.Loudness = FMath::Max(Event.Loudness, Loudness);
+			Event.Time = Now;
+			return;
+		}
+	}
+
+	NoiseEvents.Add({Location2D, Loudness, Now});
+}
+
+bool UTacticalInfluenceSubsystem::WorldToCell(const FInfluenceGrid& Grid, const FVector& Location, int32& OutIndex) const
+{
+	const FVector2D Local = (FVector2D(Location) - Grid.Origin) / CellSize;
+	const int32 X = FMath::FloorToInt32(Local.X);
+	const int32 Y = FMath::FloorToInt32(Local.Y);
+	if (X < 0 || Y < 0 || X >= GridSize || Y >= GridSize)
+		return false;
+
+	OutIndex = Y * GridSize + X;
+	return true;
+}
+
+float UTacticalInfluenceSubsystem::GetInfluence(const FVector& Location, ETacticalInfluenceLayer Layer) const
+{
+	if (!bHasValidFront || Layer == ETacticalInfluenceLayer::Num)
+		return 0.0f;
+
+	const FInfluenceGrid& Front = Grids[FrontIndex];
+	int32 CellIndex;
+	if (!WorldToCell(Front, Location, CellIndex))
+		return 0.0f;
+
+	return Front.Layers[static_cast<int32>(Layer)][CellIndex];
+}
+
+float UTacticalInfluenceSubsystem::ScoreLocation(const FVector& Location, const FTacticalInfluenceWeights& Weights) const
+{
+	if (!bHasValidFront)
+		return 0.0f;
+
+	const FInfluenceGrid& Front = Grids[FrontIndex];
+	int32 CellIndex;
+	if (!WorldToCell(Front, Location, CellIndex))
+		return 0.0f;
+
+	return Front.Layers[static_cast<int32>(ETacticalInfluenceLayer::Threat)][CellIndex] * Weights.Threat
+		+ Front.Layers[static_cast<int32>(ETacticalInfluenceLayer::PlayerPresence)][CellIndex] * Weights.PlayerPresence
+		+ Front.Layers[static_cast<int32>(ETacticalInfluenceLayer::Noise)][CellIndex] * Weights.Noise
+		+ Front.Layers[static_cast<int32>(ETacticalInfluenceLayer::ZombieDensity)][CellIndex] * Weights.ZombieDensity;
+}
+
+bool UTacticalInfluenceSubsystem::IsInsideMap(const FVector& Location) const
+{
+	int32 CellIndex;
+	return bHasValidFront && WorldToCell(Grids[FrontIndex], Location, CellIndex);
+}
@@ -0,0 +1,83 @@
+#include "AI/Tasks/BTTask_FindTacticalLocation.h"
+
+#include "AIController.h"
+#include "NavigationSystem.h"
+#include "BehaviorTree/BlackboardComponent.h"
+
+
+UBTTask_FindTacticalLocation::UBTTask_FindTacticalLocation()
+{
+	NodeName = TEXT("Find Tactical Location");
+
+	Weights.Threat = -1.0f;
+	Weights.ZombieDensity = -0.5f;
+
+	OriginActorKey.AllowNoneAsValue(true);
+	OriginActorKey.AddObjectFilter(this, GET_MEMBER_NAME_CHECKED(UBTTask_FindTacticalLocation, OriginActorKey), AActor::StaticClass());
+	ResultLocationKey.AddVectorFilter(this, GET_MEMBER_NAME_CHECKED(UBTTask_FindTacticalLocation, ResultLocationKey));
+}
+
+EBTNodeResult::Type UBTTask_FindTacticalLocation::ExecuteTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
+{
+	AAIController* AIController = OwnerComp.GetAIOwner();
+	UBlackboardComponent* BBComp = OwnerComp.GetBlackboardComponent();
+	APawn* SelfPawn = AIController ? AIController->GetPawn() : nullptr;
+	if (!SelfPawn || !BBComp)
+	{
+		return EBTNodeResult::Failed;
+	}
+
+	const UTacticalInfluenceSubsystem* InfluenceMap = UWorld::GetSubsystem<UTacticalInfluenceSubsystem>(OwnerComp.GetWorld());
+	if (!InfluenceMap || !InfluenceMap->HasValidMap())
+	{
+		return EBTNodeResult::Failed;
+	}
+
+	// 후보 지점의 중심
+	const AActor* OriginActor = Cast<AActor>(BBComp->GetValueAsObject(OriginActorKey.SelectedKeyName));
+	const FVector SelfLocation = SelfPawn->GetActorLocation();
+	const FVector Origin = OriginActor ? OriginActor->GetActorLocation() : SelfLocation;
+
+	// 원 위의 후보 지점 점수화 (후보당 O(1) 조회)
+	const float StartAngle = FMath::FRandRange(0.0f, UE_TWO_PI);
+	const float AngleStep = UE_TWO_PI / NumSamples;
+	FVector BestLocation = FVector::ZeroVector;
+	float BestScore = -MAX_flt;
+	for (int32 SampleIndex = 0; SampleIndex < NumSamples; ++SampleIndex)
+	{
+		float Sin, Cos;
+		FMath::SinCos(&Sin, &Cos, StartAngle + AngleStep * SampleIndex);
+		const FVector Candidate = Origin + FVector(Cos, Sin, 0.0f) * SampleRadius;
+		if (!InfluenceMap->IsInsideMap(Candidate))
+		{
+			continue;
+		}
+
+		const float DistancePenalty = FVector::Dist2D(SelfLocation, Candidate) * 0.01f * DistancePenaltyPerMeter;
+		const float Score = InfluenceMap->ScoreLocation(Candidate, Weights) - DistancePenalty;
+		if (Score > BestScore)
+		{
+			BestScore = Score;
+			BestLocation = Candidate;
+		}
+	}
+
+	if (BestScore == -MAX_flt)
+	{
+		return EBTNodeResult::Failed;
+	}
+
+	// 이동 가능한 위치로 보정
+	if (UNavigationSystemV1* NavSys = UNavigationSystemV1::GetNavigationSystem(SelfPawn))
+	{
+		FNavLocation ProjectedLocation;
+		if (!NavSys->ProjectPointToNavigation(BestLocation, ProjectedLocation))
+		{
+			return EBTNodeResult::Failed;
+		}
+		BestLocation = ProjectedLocation.Location;
+	}
+
+	BBComp->SetValueAsVector(ResultLocationKey.SelectedKeyName, BestLocation);
+	return EBTNodeResult::Succeeded;
+}
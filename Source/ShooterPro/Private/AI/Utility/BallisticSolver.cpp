@@ -0,0 +1,134 @@
+#include "AI/Utility/BallisticSolver.h"
+
+#include "Async/ParallelFor.h"
+#include "Projectile/BallisticSimulationSubsystem.h"
+
+DECLARE_CYCLE_STAT(TEXT("Ballistic Solve Batch"), STAT_ProProjectile_BallisticSolveBatch, STATGROUP_ProProjectile);
+
+
+int32 FBallisticSolver::SolveArcs(const FVector& Start, const FVector& Target, float Speed, float GravityZ,
+                                  FVector& OutLowVelocity, FVector& OutHighVelocity, float* OutLowTime, float* OutHighTime)
+{
+	if (Speed <= UE_KINDA_SMALL_NUMBER)
+		return 0;
+
+	const FVector Delta = Target - Start;
+	const FVector2D HorizontalDelta(Delta.X, Delta.Y);
+	const double X = HorizontalDelta.Size();
+	const double Y = Delta.Z;
+	const double G = -GravityZ;
+
+	// 중력이 없으면 직선
+	if (FMath::Abs(G) <= UE_KINDA_SMALL_NUMBER)
+	{
+		OutLowVelocity = OutHighVelocity = Delta.GetSafeNormal() * Speed;
+		const float Time = static_cast<float>(Delta.Size() / Speed);
+		if (OutLowTime) *OutLowTime = Time;
+		if (OutHighTime) *OutHighTime = Time;
+		return 1;
+	}
+
+	const double V2 = FMath::Square(static_cast<double>(Speed));
+
+	// 수직 발사 (수평 거리 없음): Y = V t - ½ G t² 에서 처음 Y에 닿는 시간
+	if (X <= UE_KINDA_SMALL_NUMBER)
+	{
+		const double V = Y >= 0.0 ? Speed : -Speed;
+		const double VerticalDiscriminant = V2 - 2.0 * G * Y;
+		if (VerticalDiscriminant < 0.0)
+			return 0;
+
+		const double VerticalRoot = FMath::Sqrt(VerticalDiscriminant);
+		const double EarlyTime = FMath::Min((V - VerticalRoot) / G, (V + VerticalRoot) / G);
+		const double LateTime = FMath::Max((V - VerticalRoot) / G, (V + VerticalRoot) / G);
+		const double FirstTime = EarlyTime >= 0.0 ? EarlyTime : LateTime;
+		if (FirstTime < 0.0)
+			return 0;
+
+		OutLowVelocity = OutHighVelocity = FVector(0.0, 0.0, V);
+		if (OutLowTime) *OutLowTime = static_cast<float>(FirstTime);
+		if (OutHighTime) *OutHighTime = static_cast<float>(FirstTime);
+		return 1;
+	}
+
+	const double Discriminant = V2 * V2 - G * (G * X * X + 2.0 * Y * V2);
+	if (Discriminant < 0.0)
+		return 0;
+
+	const double Root = FMath::Sqrt(Discriminant);
+	const FVector2D HorizontalDir = HorizontalDelta / X;
+
+	auto MakeVelocity = [&](double TanTheta, FVector& OutVelocity, float* OutTime)
+	{
+		const double CosTheta = 1.0 / FMath::Sqrt(1.0 + TanTheta * TanTheta);
+		const double SinTheta = TanTheta * CosTheta;
+		const double HorizontalSpeed = Speed * CosTheta;
+
+		OutVelocity = FVector(HorizontalDir.X * HorizontalSpeed, HorizontalDir.Y * HorizontalSpeed, Speed * SinTheta);
+		if (OutTime)
+			*OutTime = static_cast<float>(X / HorizontalSpeed);
+	};
+
+	MakeVelocity((V2 - Root) / (G * X), OutLowVelocity, OutLowTime);
+	MakeVelocity((V2 + Root) / (G * X), OutHighVelocity, OutHighTime);
+
+	return Root <= UE_KINDA_SMALL_NUMBER ? 1 : 2;
+}
+
+FBallisticSolution FBallisticSolver::Solve(const FBallisticSolveRequest& Request)
+{
+	FBallisticSolution Solution;
+
+	FVector AimLocation = Request.TargetLocation;
+	float PreviousTime = -1.0f;
+
+	const bool bMovingTarget = !Request.TargetVelocity.IsNearlyZero();
+	const int32 NumIterations = bMovingTarget ? MaxInterceptIterations : 1;
+
+	for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+	{
+		FVector LowVelocity, HighVelocity;
+		float LowTime = 0.0f, HighTime = 0.0f;
+		if (SolveArcs(Request.Start, AimLocation, Request.Speed, Request.GravityZ, LowVelocity, HighVelocity, &LowTime, &HighTime) == 0)
+		{
+			// 예측 위치가 사거리 밖이면 직전 해를 그대로 사용
+			return Solution;
+		}
+
+		Solution.Velocity = Request.bHighArc ? HighVelocity : LowVelocity;
+		Solution.FlightTime = Request.bHighArc ? HighTime : LowTime;
+		Solution.bValid = true;
+
+		// 비행 시간이 더 이상 변하지 않으면 수렴
+		if (FMath::Abs(Solution.FlightTime - PreviousTime) < 1.e-3f)
+			break;
+
+		PreviousTime = Solution.FlightTime;
+		AimLocation = Request.TargetLocation + Request.TargetVelocity * Solution.FlightTime;
+	}
+
+	return Solution;
+}
+
+void FBallisticSolver::SolveBatch(TConstArrayView<FBallisticSolveRequest> Requests, TArrayView<FBallisticSolution> OutSolutions)
+{
+	SCOPE_CYCLE_COUNTER(STAT_ProProjectile_BallisticSolveBatch);
+
+	check(Requests.Num() == OutSolutions.Num());
+
+	const int32 NumRequests = Requests.Num();
+	if (NumRequests >= ParallelBatchThreshold)
+	{
+		ParallelFor(NumRequests, [&Requests, &OutSolutions](int32 Index)
+		{
+			OutSolutions[Index] = Solve(Requests[Index]);
+		});
+	}
+	else
+	{
+		for (int32 Index = 0; Index < NumRequests; ++Index)
+		{
+			OutSolutions[Index] = Solve(Requests[Index]);
+		}
+	}
+}
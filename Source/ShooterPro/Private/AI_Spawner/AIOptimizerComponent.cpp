@@ -19,6 +19,12 @@ UAIOptimizerComponent::UAIOptimizerComponent()
 	LayerShort = 1000.f;
 	LayerMiddle = 2500.f;
 	LayerLong = 4000.f;
+
+	bUseBehaviorTreeLOD = true;
+	ShortLayerServiceIntervalScale = 1.f;
+	MiddleLayerServiceIntervalScale = 3.f;
+
+	CurrentLayer = 2;
 }
 
 void UAIOptimizerComponent::BeginPlay()
@@ -48,7 +54,12 @@ void UAIOptimizerComponent::SetAILogicEnabled(ACharacter* Actor, AAIController*
 	{
 		if (bEnable)
 		{
-			if (!BrainComp->IsRunning())
+			// A paused tree resumes where it left off, no restart burst
+			if (BrainComp->IsPaused())
+			{
+				BrainComp->ResumeLogic(TEXT("Custom Optimizer"));
+			}
+			else if (!BrainComp->IsRunning())
 			{
 				BrainComp->RestartLogic();
 			}
@@ -57,7 +68,14 @@ void UAIOptimizerComponent::SetAILogicEnabled(ACharacter* Actor, AAIController*
 		{
 			if (BrainComp->IsRunning())
 			{
-				BrainComp->StopLogic(TEXT("Custom Optimizer"));
+				if (bUseBehaviorTreeLOD)
+				{
+					BrainComp->PauseLogic(TEXT("Custom Optimizer"));
+				}
+				else
+				{
+					BrainComp->StopLogic(TEXT("Custom Optimizer"));
+				}
 			}
 		}
 	}
@@ -153,6 +171,7 @@ void UAIOptimizerComponent::OptimizerChecker()
 void UAIOptimizerComponent::LayerCheckLoop()
 {
 	int32 LayerNum = DistanceLayer();
+	CurrentLayer = LayerNum;
 
 	switch (LayerNum)
 	{
@@ -221,6 +240,39 @@ int32 UAIOptimizerComponent::DistanceLayer()
 	return -1;
 }
 
+float UAIOptimizerComponent::GetServiceIntervalScale() const
+{
+	if (!bUseBehaviorTreeLOD)
+	{
+		return 1.f;
+	}
+
+	switch (CurrentLayer)
+	{
+	case 2:
+		return ShortLayerServiceIntervalScale;
+
+	case 1:
+		return MiddleLayerServiceIntervalScale;
+
+	default:
+		// The tree is paused on farther layers, keep the slowest rate when it resumes
+		return MiddleLayerServiceIntervalScale;
+	}
+}
+
+float UAIOptimizerComponent::GetServiceIntervalScale(const AAIController* AIC)
+{
+	const APawn* Pawn = AIC ? AIC->GetPawn() : nullptr;
+	if (!Pawn)
+	{
+		return 1.f;
+	}
+
+	const UAIOptimizerComponent* OptimizerComp = Pawn->FindComponentByClass<UAIOptimizerComponent>();
+	return OptimizerComp ? OptimizerComp->GetServiceIntervalScale() : 1.f;
+}
+
 void UAIOptimizerComponent::OptimizerCheckerStop()
 {
 	GetWorld()->GetTimerManager().ClearTimer(LayerCheckLoopTimer);
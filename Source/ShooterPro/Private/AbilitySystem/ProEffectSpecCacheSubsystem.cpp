@@ -0,0 +1,222 @@
+#include "AbilitySystem/ProEffectSpecCacheSubsystem.h"
+
+#include "AbilitySystemComponent.h"
+#include "GameplayEffect.h"
+#include "Engine/World.h"
+
+DEFINE_STAT(STAT_ProEffects_CachedSpecs);
+DEFINE_STAT(STAT_ProEffects_SpecCacheHits);
+DEFINE_STAT(STAT_ProEffects_SpecCacheMisses);
+DEFINE_STAT(STAT_ProEffects_BatchedApplications);
+
+
+bool UProEffectSpecCacheSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UProEffectSpecCacheSubsystem::Deinitialize()
+{
+	PendingApplications.Empty();
+	CachedSpecs.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UProEffectSpecCacheSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UProEffectSpecCacheSubsystem, STATGROUP_Tickables);
+}
+
+void UProEffectSpecCacheSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	FlushPendingApplications();
+	EvictExpiredSpecs();
+
+	SET_DWORD_STAT(STAT_ProEffects_CachedSpecs, CachedSpecs.Num());
+}
+
+void UProEffectSpecCacheSubsystem::ApplyNow(const FProEffectApplication& Application)
+{
+	if (!Application.SourceASC.IsValid() || !Application.TargetASC.IsValid() || !Application.EffectClass)
+		return;
+
+	const FGameplayEffectSpecHandle SpecHandle = FindOrMakeSpec(MakeKey(Application), Application);
+	if (SpecHandle.IsValid())
+	{
+		ApplySpec(SpecHandle, Application);
+	}
+}
+
+void UProEffectSpecCacheSubsystem::Enqueue(FProEffectApplication&& Application)
+{
+	if (!Application.EffectClass)
+		return;
+
+	PendingApplications.Add(MoveTemp(Application));
+}
+
+void UProEffectSpecCacheSubsystem::Apply(const UObject* WorldContextObject, FProEffectApplication&& Application, bool bBatched)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	if (UProEffectSpecCacheSubsystem* Subsystem = World ? World->GetSubsystem<UProEffectSpecCacheSubsystem>() : nullptr)
+	{
+		if (bBatched)
+			Subsystem->Enqueue(MoveTemp(Application));
+		else
+			Subsystem->ApplyNow(Application);
+		return;
+	}
+
+	UAbilitySystemComponent* SourceASC = Application.SourceASC.Get();
+	if (!SourceASC || !Application.TargetASC.IsValid() || !Application.EffectClass)
+		return;
+
+	FGameplayEffectContextHandle ContextHandle = SourceASC->MakeEffectContext();
+	ContextHandle.AddSourceObject(Application.HasHitSourceObject() ? Application.HitSourceObject.Get() : Application.SourceObject.Get());
+	if (Application.bHasHitResult)
+		ContextHandle.AddHitResult(Application.HitResult);
+
+	const FGameplayEffectSpecHandle SpecHandle = SourceASC->MakeOutgoingSpec(Application.EffectClass, Application.Level, ContextHandle);
+	if (SpecHandle.IsValid())
+		SourceASC->ApplyGameplayEffectSpecToTarget(*SpecHandle.Data.Get(), Application.TargetASC.Get());
+}
+
+FProEffectSpecCacheKey UProEffectSpecCacheSubsystem::MakeKey(const FProEffectApplication& Application)
+{
+	FProEffectSpecCacheKey Key;
+	Key.EffectClass = TObjectKey<UClass>(Application.EffectClass.Get());
+	Key.SourceASC = TObjectKey<UAbilitySystemComponent>(Application.SourceASC.Get());
+	Key.SourceObject = TObjectKey<UObject>(Application.SourceObject.Get());
+	Key.Level = Application.Level;
+	Key.bWithHitResult = Application.bHasHitResult;
+	Key.bWithHitSourceObject = Application.HasHitSourceObject();
+	return Key;
+}
+
+FGameplayEffectSpecHandle UProEffectSpecCacheSubsystem::FindOrMakeSpec(const FProEffectSpecCacheKey& Key, const FProEffectApplication& Application)
+{
+	const double Now = GetWorld()->GetTimeSeconds();
+
+	if (const FCachedSpec* Cached = CachedSpecs.Find(Key))
+	{
+		if (Now - Cached->CreationTime <= MaxSpecAge)
+		{
+			INC_DWORD_STAT(STAT_ProEffects_SpecCacheHits);
+			return Cached->SpecHandle;
+		}
+	}
+
+	INC_DWORD_STAT(STAT_ProEffects_SpecCacheMisses);
+
+	UAbilitySystemComponent* SourceASC = Application.SourceASC.Get();
+	FGameplayEffectContextHandle ContextHandle = SourceASC->MakeEffectContext();
+	ContextHandle.AddSourceObject(Application.SourceObject.Get());
+
+	const FGameplayEffectSpecHandle SpecHandle = SourceASC->MakeOutgoingSpec(Application.EffectClass, Application.Level, ContextHandle);
+	if (SpecHandle.IsValid())
+	{
+		FCachedSpec& Cached = CachedSpecs.Add(Key);
+		Cached.SpecHandle = SpecHandle;
+		Cached.CreationTime = Now;
+	}
+	return SpecHandle;
+}
+
+void UProEffectSpecCacheSubsystem::ApplySpec(const FGameplayEffectSpecHandle& SpecHandle, const FProEffectApplication& Application)
+{
+	FGameplayEffectSpec& Spec = *SpecHandle.Data.Get();
+
+	auto PatchContext = [&Application](FGameplayEffectContextHandle& ContextHandle)
+	{
+		if (Application.bHasHitResult)
+			ContextHandle.AddHitResult(Application.HitResult, /*bReset=*/true);
+		if (Application.HasHitSourceObject())
+			ContextHandle.AddSourceObject(Application.HitSourceObject.Get());
+	};
+
+	if (Application.bHasHitResult || Application.HasHitSourceObject())
+	{
+		// 지속 이펙트는 적용된 뒤에도 Context를 들고 있으므로 공유 Context를 바꾸면 이미 적용된 이펙트의 값까지 바뀐다
+		if (Spec.Def && Spec.Def->DurationPolicy != EGameplayEffectDurationType::Instant)
+		{
+			FGameplayEffectContextHandle ContextHandle = Spec.GetContext().Duplicate();
+			PatchContext(ContextHandle);
+
+			FGameplayEffectSpec DurationSpec(Spec);
+			DurationSpec.SetContext(ContextHandle, /*bSkipRecaptureSourceActorTags=*/true);
+			Application.SourceASC->ApplyGameplayEffectSpecToTarget(DurationSpec, Application.TargetASC.Get());
+			return;
+		}
+
+		// 즉시 이펙트는 적용 중에만 Context를 보므로 값만 교체 (새 Context 할당 없음)
+		FGameplayEffectContextHandle ContextHandle = Spec.GetContext();
+		PatchContext(ContextHandle);
+	}
+
+	Application.SourceASC->ApplyGameplayEffectSpecToTarget(Spec, Application.TargetASC.Get());
+}
+
+void UProEffectSpecCacheSubsystem::FlushPendingApplications()
+{
+	if (PendingApplications.Num() == 0)
+		return;
+
+	// 적용 중에 다시 Enqueue될 수 있으므로 먼저 꺼내둔다
+	TArray<FProEffectApplication> Applications = MoveTemp(PendingApplications);
+	PendingApplications.Reset();
+
+	TArray<TPair<FProEffectSpecCacheKey, int32>> SortedKeys;
+	SortedKeys.Reserve(Applications.Num());
+	for (int32 Index = 0; Index < Applications.Num(); ++Index)
+	{
+		const FProEffectApplication& Application = Applications[Index];
+		if (Application.SourceASC.IsValid() && Application.TargetASC.IsValid())
+			SortedKeys.Emplace(MakeKey(Application), Index);
+	}
+
+	// 같은 키끼리 붙여서 Spec 조회를 묶음당 한 번으로 줄인다 (해시 순, 같은 해시 안에서는 요청 순)
+	SortedKeys.StableSort([](const TPair<FProEffectSpecCacheKey, int32>& A, const TPair<FProEffectSpecCacheKey, int32>& B)
+	{
+		return GetTypeHash(A.Key) < GetTypeHash(B.Key);
+	});
+
+	// 핸들은 값으로 들고 있는다 (적용 중 델리게이트에서 캐시가 추가되어 맵이 재배치될 수 있음)
+	FGameplayEffectSpecHandle SpecHandle;
+	const FProEffectSpecCacheKey* CurrentKey = nullptr;
+	for (const TPair<FProEffectSpecCacheKey, int32>& SortedKey : SortedKeys)
+	{
+		const FProEffectApplication& Application = Applications[SortedKey.Value];
+
+		// 이전 적용의 GameplayCue/델리게이트에서 소스 ASC가 사라졌을 수 있음
+		if (!Application.SourceASC.IsValid() || !Application.TargetASC.IsValid())
+			continue;
+
+		if (!CurrentKey || !(*CurrentKey == SortedKey.Key))
+		{
+			CurrentKey = &SortedKey.Key;
+			SpecHandle = FindOrMakeSpec(SortedKey.Key, Application);
+		}
+
+		if (SpecHandle.IsValid())
+		{
+			ApplySpec(SpecHandle, Application);
+			INC_DWORD_STAT(STAT_ProEffects_BatchedApplications);
+		}
+	}
+}
+
+void UProEffectSpecCacheSubsystem::EvictExpiredSpecs()
+{
+	const double Now = GetWorld()->GetTimeSeconds();
+
+	for (auto It = CachedSpecs.CreateIterator(); It; ++It)
+	{
+		if (Now - It->Value.CreationTime > MaxSpecAge || !It->Value.SpecHandle.Data->GetContext().GetInstigatorAbilitySystemComponent())
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
@@ -183,3 +183,45 @@ void UProGSCAbilitySet::TryGrantAbility(UAbilitySystemComponent* InASC,
 		GSC_LOG(Verbose, TEXT("AddActorAbilities: Not Authority, try to find ability handle from spec: %s"), *OutAbilityHandle.ToString())
 	}
 }
+
+void UProGSCAbilitySet::GatherSoftReferences(TArray<FSoftObjectPath>& OutPaths) const
+{
+	for (const FGSCGameFeatureAbilityMapping& AbilityMapping : GrantedAbilities)
+	{
+		if (!AbilityMapping.AbilityType.IsNull()) OutPaths.Add(AbilityMapping.AbilityType.ToSoftObjectPath());
+		if (!AbilityMapping.InputAction.IsNull()) OutPaths.Add(AbilityMapping.InputAction.ToSoftObjectPath());
+	}
+
+	for (const FGSCGameFeatureAttributeSetMapping& Attributes : GrantedAttributes)
+	{
+		if (!Attributes.AttributeSet.IsNull()) OutPaths.Add(Attributes.AttributeSet.ToSoftObjectPath());
+		if (!Attributes.InitializationData.IsNull()) OutPaths.Add(Attributes.InitializationData.ToSoftObjectPath());
+	}
+
+	for (const FGSCGameFeatureGameplayEffectMapping& Effect : GrantedEffects)
+	{
+		if (!Effect.EffectType.IsNull()) OutPaths.Add(Effect.EffectType.ToSoftObjectPath());
+	}
+}
+
+bool UProGSCAbilitySet::AreSoftReferencesLoaded() const
+{
+	for (const FGSCGameFeatureAbilityMapping& AbilityMapping : GrantedAbilities)
+	{
+		if (!AbilityMapping.AbilityType.IsNull() && !AbilityMapping.AbilityType.Get()) return false;
+		if (!AbilityMapping.InputAction.IsNull() && !AbilityMapping.InputAction.Get()) return false;
+	}
+
+	for (const FGSCGameFeatureAttributeSetMapping& Attributes : GrantedAttributes)
+	{
+		if (!Attributes.AttributeSet.IsNull() && !Attributes.AttributeSet.Get()) return false;
+		if (!Attributes.InitializationData.IsNull() && !Attributes.InitializationData.Get()) return false;
+	}
+
+	for (const FGSCGameFeatureGameplayEffectMapping& Effect : GrantedEffects)
+	{
+		if (!Effect.EffectType.IsNull() && !Effect.EffectType.Get()) return false;
+	}
+
+	return true;
+}
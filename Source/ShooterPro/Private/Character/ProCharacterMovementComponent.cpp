@@ -3,6 +3,7 @@
 
 #include "Character/ProCharacterMovementComponent.h"
 
+#include "AI/Subsystems/CrowdSeparationSubsystem.h"
 #include "Components/CapsuleComponent.h"
 #include "GameFramework/Character.h"
 
@@ -52,3 +53,9 @@ float UProCharacterMovementComponent::GetGroundDistance()
 
 	return GroundDistance;
 }
+
+bool UProCharacterMovementComponent::ResolvePenetrationImpl(const FVector& Adjustment, const FHitResult& Hit, const FQuat& NewRotation)
+{
+	INC_DWORD_STAT(STAT_ProCrowd_Depenetrations);
+	return Super::ResolvePenetrationImpl(Adjustment, Hit, NewRotation);
+}
@@ -3,79 +3,196 @@
 
 #include "Equipment/Abilities/ProGameplayAbility_RangedWeapon.h"
 
+#include "AbilitySystemComponent.h"
+#include "AbilitySystemGlobals.h"
+#include "ProGmaeplayTag.h"
 #include "Equipment/EquipmentInstance.h"
 #include "Equipment/Weapon/RangedWeaponInstance.h"
+#include "Equipment/Weapon/WeaponSpreadSampler.h"
 #include "Inventory/ProBulletBase.h"
+#include "GameFramework/ProjectileMovementComponent.h"
+#include "Projectile/BallisticSimulationSubsystem.h"
 #include "Projectile/ProjectileManagerComponent.h"
+#include "Components/MeshComponent.h"
+#include "GameFramework/PlayerController.h"
 
 void UProGameplayAbility_RangedWeapon::FireWeapon(FVector StartLocation, FVector Direction, TSubclassOf<AProBulletBase> BulletClass)
 {
 	URangedWeaponInstance* WeaponInstance = GetSourceRangedWeaponInstance();
 
+	// 발사로 열/탄 퍼짐이 바뀌므로 잠든 무기 갱신 재개
+	if (WeaponInstance)
+		WeaponInstance->WakeUp();
+
+	if (WeaponInstance && WeaponInstance->UsesHitscanPellets())
+	{
+		FireHitscanPellets(WeaponInstance, StartLocation, Direction, BulletClass);
+		return;
+	}
+
+	// 액터 없이 시뮬레이션하는 탄환이면 서브시스템으로 발사
+	const AProBulletBase* BulletCDO = BulletClass ? BulletClass->GetDefaultObject<AProBulletBase>() : nullptr;
+	UBallisticSimulationSubsystem* BallisticSimulation = (BulletCDO && BulletCDO->ShouldSimulateWithoutActor()) ? UWorld::GetSubsystem<UBallisticSimulationSubsystem>(GetWorld()) : nullptr;
+
 	UProjectileManagerComponent* ProjectileManager = Cast<UProjectileManagerComponent>(GetAvatarActorFromActorInfo()->GetComponentByClass(UProjectileManagerComponent::StaticClass()));
 
-	if (!ensure(ProjectileManager)) return;
+	if (!BallisticSimulation && !ensure(ProjectileManager)) return;
 	
 	int BulletPerCartridge = WeaponInstance->GetBulletsPerCartridge();
 
+	const float SpreadAngle = WeaponInstance->GetCalculatedSpreadAngle();
+	const float SpreadAngleMultiplier = WeaponInstance->GetCalculatedSpreadAngleMultiplier();
+	const float ActualSpreadAngle = SpreadAngle * SpreadAngleMultiplier;
+
+	const float HalfSpreadAngleInRadians = FMath::DegreesToRadians(ActualSpreadAngle * 0.5f);
+
+	// 한 카트리지의 탄 방향을 무기 스트림에서 한 번에 생성
+	TArray<FVector, TInlineAllocator<16>> BulletDirections;
+	BulletDirections.SetNumUninitialized(FMath::Max(BulletPerCartridge, 0));
+	FWeaponSpreadSampler::SampleConeBatch(Direction, HalfSpreadAngleInRadians, WeaponInstance->GetSpreadExponent(), WeaponInstance->GetSpreadRandomStream(), BulletDirections);
+
 	for (int i = 0; i < BulletPerCartridge; ++i)
 	{
-		const float SpreadAngle = WeaponInstance->GetCalculatedSpreadAngle();
-		const float SpreadAngleMultiplier = WeaponInstance->GetCalculatedSpreadAngleMultiplier();
-		const float ActualSpreadAngle = SpreadAngle * SpreadAngleMultiplier;
+		const FVector& ActualDir = BulletDirections[i];
 
-		const float HalfSpreadAngleInRadians = FMath::DegreesToRadians(ActualSpreadAngle * 0.5f);
+		if (BallisticSimulation)
+		{
+			FProBallisticShot Shot;
+			Shot.Instigator = GetAvatarActorFromActorInfo();
+			Shot.Start = StartLocation;
+			Shot.Direction = ActualDir;
+			Shot.Radius = BulletCDO->GetCollisionRadius();
+			Shot.CollisionChannel = BulletCDO->GetCollisionObjectType();
+			Shot.CollisionResponses = BulletCDO->GetCollisionResponses();
+			Shot.DamageEffect = BulletCDO->GetDamageEffect();
+			if (const UProjectileMovementComponent* Movement = BulletCDO->GetProjectileMovement())
+			{
+				Shot.Speed = Movement->InitialSpeed;
+				Shot.GravityScale = Movement->ProjectileGravityScale;
+			}
+			BallisticSimulation->FireBullet(Shot);
+			continue;
+		}
 
-		const FVector ActualDir = RandConeNormalDistribution(Direction, HalfSpreadAngleInRadians, WeaponInstance->GetSpreadExponent());
-		
 		AProBulletBase* Bullet = ProjectileManager->RequestBullet(BulletClass);
+		if (!Bullet)
+			continue; // 풀 상한 도달
+
 		FRotator BulletRotation = ActualDir.Rotation();
 		Bullet->ActivateBullet(GetAvatarActorFromActorInfo(), StartLocation, BulletRotation, ActualDir);
 	}
 }
 
 
-FVector UProGameplayAbility_RangedWeapon::RandConeNormalDistribution(const FVector& Dir, const float ConeHalfAngleRad,
-	const float Exponent)
+void UProGameplayAbility_RangedWeapon::FireHitscanPellets(URangedWeaponInstance* WeaponInstance, const FVector& StartLocation, const FVector& Direction, TSubclassOf<AProBulletBase> BulletClass)
 {
-	if (ConeHalfAngleRad > 0.f)
+	AActor* Avatar = GetAvatarActorFromActorInfo();
+	UWorld* World = GetWorld();
+	if (!Avatar || !World)
+		return;
+
+	const int32 NumPellets = FMath::Max(WeaponInstance->GetBulletsPerCartridge(), 1);
+
+	// 1) 모든 펠릿 방향을 한 번에 생성
+	const float ActualSpreadAngle = WeaponInstance->GetCalculatedSpreadAngle() * WeaponInstance->GetCalculatedSpreadAngleMultiplier();
+	const float HalfSpreadAngleInRadians = FMath::DegreesToRadians(ActualSpreadAngle * 0.5f);
+
+	TArray<FVector, TInlineAllocator<16>> PelletEnds;
+	PelletEnds.SetNumUninitialized(NumPellets);
+	FWeaponSpreadSampler::SampleConeBatch(Direction, HalfSpreadAngleInRadians, WeaponInstance->GetSpreadExponent(), WeaponInstance->GetSpreadRandomStream(), PelletEnds);
+	for (FVector& PelletEnd : PelletEnds)
 	{
-		const float ConeHalfAngleDegrees = FMath::RadiansToDegrees(ConeHalfAngleRad);
-		
-		// 0~1 사이 난수 생성
-		const float FromCenter = FMath::Pow(FMath::FRand(), Exponent);
-		// 원뿔 중심에서 벗어나는 각도 생성
-		const float AngleFromCenter = FromCenter * ConeHalfAngleDegrees;
-		// 0~360도 범위에 랜덤 회전 각도 생성
-		const float AngleAround = FMath::FRand() * 360.f;
+		PelletEnd = StartLocation + PelletEnd * WeaponInstance->GetLineTraceRange();
+	}
 
-		// 현재 조준 방향을 회전 값으로 변환
-		FRotator Rot = Dir.Rotation();
-		// 계산할거니 쿼터니언으로 변환
-		FQuat DirQuat(Rot);
+	// 2) 모든 펠릿을 게임 스레드에서 차례로 트레이스 (쿼리 파라미터는 공유)
+	FCollisionQueryParams TraceParams(SCENE_QUERY_STAT(HitscanPellets), true);
+	TraceParams.AddIgnoredActor(Avatar);
+
+	TArray<FHitResult> PelletHits;
+	PelletHits.SetNum(NumPellets);
+	for (int32 Index = 0; Index < NumPellets; ++Index)
+	{
+		World->LineTraceSingleByChannel(PelletHits[Index], StartLocation, PelletEnds[Index], ECC_Visibility, TraceParams);
+	}
 
-		// 원뿔 중심에서 벗어나는 방향을 쿼터니언 회전으로 적용
-		//FQuat FromCenterQuat(FRotator(0.0f, AngleFromCenter, 0.0f));
-		FQuat FromCenterQuat(FRotator(AngleFromCenter, 0.0f, 0.0f)); 
+	// 3) 대상별로 명중 수 합산
+	TMap<AActor*, int32, TInlineSetAllocator<16>> HitCounts;
+	TMap<AActor*, int32, TInlineSetAllocator<16>> FirstHitIndices;
+	TArray<FHitResult> BlockingHits;
+	for (int32 Index = 0; Index < NumPellets; ++Index)
+	{
+		const FHitResult& Hit = PelletHits[Index];
+		if (!Hit.bBlockingHit)
+			continue;
+
+		BlockingHits.Add(Hit);
+		if (AActor* HitActor = Hit.GetActor())
+		{
+			++HitCounts.FindOrAdd(HitActor);
+			FirstHitIndices.FindOrAdd(HitActor, Index);
+		}
+	}
+
+	// 4) 대상마다 GameplayEffect 한 번 적용
+	const AProBulletBase* BulletCDO = BulletClass ? BulletClass->GetDefaultObject<AProBulletBase>() : nullptr;
+	const TSubclassOf<UGameplayEffect> DamageEffect = BulletCDO ? BulletCDO->GetDamageEffect() : nullptr;
+	UAbilitySystemComponent* SourceASC = GetAbilitySystemComponentFromActorInfo();
+	if (DamageEffect && SourceASC)
+	{
+		// 펠릿 무기는 SetByCaller.Damage로 합산한 데미지를 대상마다 한 번 적용한다
+		const float PelletDamage = WeaponInstance->GetPelletDamage();
+		ensureMsgf(PelletDamage > 0.0f, TEXT("%s: 히트스캔 펠릿 무기는 PelletDamage가 필요합니다."), *GetNameSafe(WeaponInstance));
+		for (const TPair<AActor*, int32>& Pair : HitCounts)
+		{
+			UAbilitySystemComponent* TargetASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(Pair.Key);
+			if (!TargetASC)
+				continue;
 
-		//원뿔 중심으로 랜덤 회전 적용
-		FQuat AroundQuat(FRotator(0.0f, 0.0, AngleAround));
+			FGameplayEffectSpecHandle SpecHandle = MakeOutgoingGameplayEffectSpec(DamageEffect, GetAbilityLevel());
+			if (!SpecHandle.IsValid())
+				continue;
 
-		//최종 회전 : DirQuat(조준경 방향) * AroundQuat(원형 회전) * FromCenterQuat(확산 적용)
-		FQuat FinalDirectionQuat = DirQuat * AroundQuat * FromCenterQuat;
-		FinalDirectionQuat.Normalize();
+			// 핸들 복사본도 같은 컨텍스트를 가리킴
+			FGameplayEffectContextHandle EffectContext = SpecHandle.Data->GetContext();
+			EffectContext.AddHitResult(PelletHits[FirstHitIndices[Pair.Key]]);
 
-		return FinalDirectionQuat.RotateVector(FVector::ForwardVector);
+			// 합산된 데미지를 한 번에. PelletDamage가 없으면 명중 수와 관계없이 한 번만 적용
+			if (PelletDamage > 0.0f)
+			{
+				SpecHandle.Data->SetSetByCallerMagnitude(ProGameplayTags::SetByCaller_Damage, PelletDamage * Pair.Value);
+			}
+			SourceASC->ApplyGameplayEffectSpecToTarget(*SpecHandle.Data.Get(), TargetASC);
+		}
 	}
-	else
+
+	K2_OnPelletsResolved(BlockingHits);
+}
+
+FVector UProGameplayAbility_RangedWeapon::RandConeNormalDistribution(const FVector& Dir, const float ConeHalfAngleRad,
+	const float Exponent)
+{
+	if (URangedWeaponInstance* WeaponInstance = GetSourceRangedWeaponInstance())
 	{
-		return Dir.GetSafeNormal();
+		return FWeaponSpreadSampler::SampleCone(Dir, ConeHalfAngleRad, Exponent, WeaponInstance->GetSpreadRandomStream());
 	}
+
+	FRandomStream Stream(FMath::Rand());
+	return FWeaponSpreadSampler::SampleCone(Dir, ConeHalfAngleRad, Exponent, Stream);
 }
 
 
 FVector UProGameplayAbility_RangedWeapon::GetHitResultWithRayCast(APlayerController* Controller)
 {	
+	URangedWeaponInstance* RangedWeaponInstance = GetSourceRangedWeaponInstance();
+
+	// 무기가 매 프레임 비동기로 갱신해 둔 조준점이 있으면 트레이스 없이 사용
+	FVector CachedAimPoint;
+	if (RangedWeaponInstance && RangedWeaponInstance->GetCachedAimPoint(CachedAimPoint))
+	{
+		return CachedAimPoint;
+	}
+
 	int32 ViewportX = 0, ViewportY = 0;
 
 	Controller->GetViewportSize(ViewportX, ViewportY);
@@ -86,8 +203,6 @@ FVector UProGameplayAbility_RangedWeapon::GetHitResultWithRayCast(APlayerControl
 
 	Controller->DeprojectScreenPositionToWorld(ScreenCenter.X, ScreenCenter.Y, WorldLocation, WorldDirection);
 
-	URangedWeaponInstance* RangedWeaponInstance = GetSourceRangedWeaponInstance();
-	
 	FVector TraceStart = WorldLocation;
 	FVector TraceEnd = TraceStart + (WorldDirection * RangedWeaponInstance->GetLineTraceRange());
 
@@ -111,3 +226,129 @@ URangedWeaponInstance* UProGameplayAbility_RangedWeapon::GetSourceRangedWeaponIn
 	}
 	return nullptr;
 }
+
+void UProGameplayAbility_RangedWeapon::StartScheduledFire(TSubclassOf<AProBulletBase> BulletClass, FName MuzzleSocketName)
+{
+	URangedWeaponInstance* WeaponInstance = GetSourceRangedWeaponInstance();
+	if (!WeaponInstance)
+		return;
+
+	ScheduledBulletClass = BulletClass;
+	ScheduledMuzzleSocketName = MuzzleSocketName.IsNone() ? FName(TEXT("Muzzle")) : MuzzleSocketName;
+	bHasLastMuzzle = false;
+
+	WeaponInstance->StartFireSchedule(FOnRangedWeaponShotsScheduled::CreateUObject(this, &UProGameplayAbility_RangedWeapon::HandleScheduledShots));
+}
+
+void UProGameplayAbility_RangedWeapon::StopScheduledFire()
+{
+	if (URangedWeaponInstance* WeaponInstance = GetSourceRangedWeaponInstance())
+	{
+		if (WeaponInstance->IsFireScheduled())
+			WeaponInstance->StopFireSchedule();
+	}
+	bHasLastMuzzle = false;
+}
+
+void UProGameplayAbility_RangedWeapon::EndAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo,
+                                                  const FGameplayAbilityActivationInfo ActivationInfo, bool bReplicateEndAbility, bool bWasCancelled)
+{
+	StopScheduledFire();
+
+	Super::EndAbility(Handle, ActorInfo, ActivationInfo, bReplicateEndAbility, bWasCancelled);
+}
+
+void UProGameplayAbility_RangedWeapon::HandleScheduledShots(TConstArrayView<FProScheduledShot> Shots)
+{
+	URangedWeaponInstance* WeaponInstance = GetSourceRangedWeaponInstance();
+	if (!WeaponInstance || !IsActive())
+	{
+		StopScheduledFire();
+		return;
+	}
+
+	FVector MuzzleStart;
+	FVector MuzzleDirection;
+	SampleMuzzle(WeaponInstance, MuzzleStart, MuzzleDirection);
+
+	if (!bHasLastMuzzle)
+	{
+		LastMuzzleStart = MuzzleStart;
+		LastMuzzleDirection = MuzzleDirection;
+	}
+
+	int32 NumFired = 0;
+	bool bOutOfCost = false;
+	for (const FProScheduledShot& Shot : Shots)
+	{
+		// 발마다 비용(탄약) 커밋
+		if (!CommitAbilityCost(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo))
+		{
+			bOutOfCost = true;
+			break;
+		}
+
+		// 발사 시각에 맞는 열/탄 퍼짐을 먼저 반영한 뒤 그 시각의 총구 위치에서 발사
+		WeaponInstance->AddShotHeat(Shot.Timestamp);
+
+		const FVector Start = FMath::Lerp(LastMuzzleStart, MuzzleStart, Shot.FrameAlpha);
+		const FVector Direction = FMath::Lerp(LastMuzzleDirection, MuzzleDirection, Shot.FrameAlpha).GetSafeNormal();
+		FireWeapon(Start, Direction.IsNearlyZero() ? MuzzleDirection : Direction, ScheduledBulletClass);
+		++NumFired;
+	}
+
+	LastMuzzleStart = MuzzleStart;
+	LastMuzzleDirection = MuzzleDirection;
+	bHasLastMuzzle = true;
+
+	if (NumFired > 0)
+		K2_OnScheduledShotsFired(NumFired);
+
+	if (bOutOfCost)
+	{
+		StopScheduledFire();
+		K2_OnScheduledFireStopped(true);
+	}
+}
+
+void UProGameplayAbility_RangedWeapon::SampleMuzzle(const URangedWeaponInstance* WeaponInstance, FVector& OutStart, FVector& OutDirection) const
+{
+	AActor* Avatar = GetAvatarActorFromActorInfo();
+
+	FVector ViewLocation = Avatar->GetActorLocation();
+	FRotator ViewRotation = Avatar->GetActorRotation();
+	Avatar->GetActorEyesViewPoint(ViewLocation, ViewRotation);
+	if (const APawn* Pawn = Cast<APawn>(Avatar))
+	{
+		if (const APlayerController* PlayerController = Cast<APlayerController>(Pawn->GetController()))
+			PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+	}
+
+	OutStart = ViewLocation;
+	if (const AActor* WeaponActor = WeaponInstance->FindSpawnedActorByClass(AActor::StaticClass()))
+	{
+		TInlineComponentArray<UMeshComponent*> Meshes(WeaponActor);
+		for (const UMeshComponent* Mesh : Meshes)
+		{
+			if (Mesh->DoesSocketExist(ScheduledMuzzleSocketName))
+			{
+				OutStart = Mesh->GetSocketLocation(ScheduledMuzzleSocketName);
+				break;
+			}
+		}
+	}
+
+	// 조준점은 비동기 조준 트레이스 캐시를 사용 (없으면 시점 정면)
+	FVector AimPoint;
+	if (WeaponInstance->GetCachedAimPoint(AimPoint))
+	{
+		OutDirection = (AimPoint - OutStart).GetSafeNormal();
+	}
+	else
+	{
+		OutDirection = ViewRotation.Vector();
+	}
+
+	if (OutDirection.IsNearlyZero())
+		OutDirection = ViewRotation.Vector();
+}
@@ -5,6 +5,7 @@
 
 #include "Components/SphereComponent.h"
 #include "Equipment/EquipmentDefinition.h"
+#include "Equipment/EquipmentManagerComponent.h"
 #include "GameFramework/Character.h"
 
 UEquipmentInstance::UEquipmentInstance(const FObjectInitializer& ObjectInitializer)
@@ -65,10 +66,17 @@ void UEquipmentInstance::SpawnEquipmentActors(const TArray<FEquipmentActorToSpaw
 			AttachTarget = Char->GetMesh();
 		}
 
+		// 최근에 해제한 장비 액터가 캐시에 있으면 스폰 없이 재사용
+		UEquipmentManagerComponent* EquipmentManager = OwningPawn->FindComponentByClass<UEquipmentManagerComponent>();
+
 		for (const FEquipmentActorToSpawn& SpawnInfo : ActorsToSpawn)
 		{
-			AActor* NewActor = GetWorld()->SpawnActorDeferred<AActor>(SpawnInfo.ActorToSpawn, FTransform::Identity, OwningPawn);
-			NewActor->FinishSpawning(FTransform::Identity, /*bIsDefaultTransform=*/ true);
+			AActor* NewActor = EquipmentManager ? EquipmentManager->AcquireCachedActor(SpawnInfo.ActorToSpawn) : nullptr;
+			if (!NewActor)
+			{
+				NewActor = GetWorld()->SpawnActorDeferred<AActor>(SpawnInfo.ActorToSpawn, FTransform::Identity, OwningPawn);
+				NewActor->FinishSpawning(FTransform::Identity, /*bIsDefaultTransform=*/ true);
+			}
 			NewActor->SetActorRelativeTransform(SpawnInfo.AttachTransform);
 			NewActor->AttachToComponent(AttachTarget, FAttachmentTransformRules::KeepRelativeTransform, SpawnInfo.AttachSocket);
 
@@ -79,10 +87,20 @@ void UEquipmentInstance::SpawnEquipmentActors(const TArray<FEquipmentActorToSpaw
 
 void UEquipmentInstance::DestroyEquipmentActors()
 {
+	APawn* OwningPawn = GetOwnerAsPawn();
+	UEquipmentManagerComponent* EquipmentManager = OwningPawn ? OwningPawn->FindComponentByClass<UEquipmentManagerComponent>() : nullptr;
+
 	for (AActor* Actor : SpawnedActors)
 	{
-		if (Actor) Actor->Destroy();
+		if (!Actor) continue;
+
+		// 캐시에 넣지 못하면(상한 0, 컴포넌트 없음) 기존처럼 파괴
+		if (!EquipmentManager || !EquipmentManager->ReleaseActorToCache(Actor))
+		{
+			Actor->Destroy();
+		}
 	}
+	SpawnedActors.Reset();
 }
 
 void UEquipmentInstance::OnEquipped()
@@ -8,7 +8,10 @@
 #include "AbilitySystem/ProGSCAbilitySet.h"
 #include "Equipment/EquipmentDefinition.h"
 #include "Equipment/EquipmentInstance.h"
+#include "Engine/AssetManager.h"
 
+DEFINE_STAT(STAT_ProEquipment_DeferredGrants);
+DEFINE_STAT(STAT_ProEquipment_PendingLoads);
 
 UEquipmentManagerComponent::UEquipmentManagerComponent(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer), EquipmentList(this)
@@ -36,6 +39,9 @@ void UEquipmentManagerComponent::UninitializeComponent()
 		UnequipItem(EquipInstance);
 	}
 
+	DestroyCachedActors();
+	CancelPendingLoads();
+
 	Super::UninitializeComponent();
 }
 
@@ -66,12 +72,19 @@ UEquipmentInstance* FEquipmentList::AddItem(TSubclassOf<UEquipmentDefinition> Eq
 	NewEntry.Instance = NewObject<UEquipmentInstance>(OwnerComponent->GetOwner(), InstanceType);
 	Result = NewEntry.Instance;
 
-	if (UGSCAbilitySystemComponent* GASC = GetGSCAbilitySystemComponent())
+	// 처음 장착하는 무기의 어빌리티 세트를 동기 로드하지 않도록, 로드가 안 됐으면 부여만 뒤로 미룬다
+	if (UEquipmentManagerComponent::AreEquipmentAssetsLoaded(EquipmentCDO))
 	{
-		for (const TObjectPtr<const UProGSCAbilitySet>& AbilitySet : EquipmentCDO->AbilitySetsToGrant)
-		{
-			AbilitySet->GrantToAbilitySystemWithSource(GASC, Result, NewEntry.GrantedHandles);
-		}
+		GrantAbilitySets(NewEntry);
+	}
+	else if (UEquipmentManagerComponent* EquipmentManager = Cast<UEquipmentManagerComponent>(OwnerComponent))
+	{
+		NewEntry.bGrantPending = true;
+		EquipmentManager->RequestDeferredGrant(EquipmentDefinition, Result);
+	}
+	else
+	{
+		GrantAbilitySets(NewEntry);
 	}
 
 	Result->SpawnEquipmentActors(EquipmentCDO->ActorsToSpawn);
@@ -79,6 +92,23 @@ UEquipmentInstance* FEquipmentList::AddItem(TSubclassOf<UEquipmentDefinition> Eq
 	return Result;
 }
 
+void FEquipmentList::GrantAbilitySets(FEquipmentItem& Entry)
+{
+	Entry.bGrantPending = false;
+
+	if (UGSCAbilitySystemComponent* GASC = GetGSCAbilitySystemComponent())
+	{
+		const UEquipmentDefinition* EquipmentCDO = GetDefault<UEquipmentDefinition>(Entry.EquipmentDefinition);
+		for (const TObjectPtr<const UProGSCAbilitySet>& AbilitySet : EquipmentCDO->AbilitySetsToGrant)
+		{
+			if (AbilitySet)
+			{
+				AbilitySet->GrantToAbilitySystemWithSource(GASC, Entry.Instance, Entry.GrantedHandles);
+			}
+		}
+	}
+}
+
 void FEquipmentList::RemoveItem(UEquipmentInstance* Instance)
 {
 	for (auto Iter = Items.CreateIterator(); Iter; ++Iter)
@@ -170,3 +200,182 @@ UEquipmentInstance* UEquipmentManagerComponent::GetEquipmentInstanceByDefinition
 	}
 	return nullptr;
 }
+
+AActor* UEquipmentManagerComponent::AcquireCachedActor(TSubclassOf<AActor> ActorClass)
+{
+	// 최근에 넣은 것부터 (정확히 같은 클래스만)
+	for (int32 Index = CachedActors.Num() - 1; Index >= 0; --Index)
+	{
+		const FCachedEquipmentActor Cached = CachedActors[Index];
+		if (!IsValid(Cached.Actor))
+		{
+			CachedActors.RemoveAt(Index, 1, EAllowShrinking::No);
+			continue;
+		}
+
+		if (Cached.Actor->GetClass() == ActorClass)
+		{
+			CachedActors.RemoveAt(Index, 1, EAllowShrinking::No);
+
+			// 스폰 때 꺼져 있던 충돌/틱을 켜지 않도록 넣기 전 상태로 복원
+			Cached.Actor->SetActorHiddenInGame(Cached.bWasHidden);
+			Cached.Actor->SetActorEnableCollision(Cached.bWasCollisionEnabled);
+			Cached.Actor->SetActorTickEnabled(Cached.bWasTickEnabled);
+			return Cached.Actor;
+		}
+	}
+
+	return nullptr;
+}
+
+bool UEquipmentManagerComponent::ReleaseActorToCache(AActor* Actor)
+{
+	if (!IsValid(Actor) || MaxCachedActors <= 0)
+		return false;
+
+	FCachedEquipmentActor& Cached = CachedActors.AddDefaulted_GetRef();
+	Cached.Actor = Actor;
+	Cached.bWasHidden = Actor->IsHidden();
+	Cached.bWasCollisionEnabled = Actor->GetActorEnableCollision();
+	Cached.bWasTickEnabled = Actor->IsActorTickEnabled();
+
+	Actor->DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
+	Actor->SetActorHiddenInGame(true);
+	Actor->SetActorEnableCollision(false);
+	Actor->SetActorTickEnabled(false);
+
+	// 상한을 넘으면 가장 오래된 것부터 파괴
+	while (CachedActors.Num() > MaxCachedActors)
+	{
+		if (AActor* Oldest = CachedActors[0].Actor)
+		{
+			Oldest->Destroy();
+		}
+		CachedActors.RemoveAt(0, 1, EAllowShrinking::No);
+	}
+
+	return true;
+}
+
+void UEquipmentManagerComponent::DestroyCachedActors()
+{
+	for (const FCachedEquipmentActor& Cached : CachedActors)
+	{
+		if (IsValid(Cached.Actor))
+		{
+			Cached.Actor->Destroy();
+		}
+	}
+	CachedActors.Empty();
+}
+
+void UEquipmentManagerComponent::PreloadEquipment(TSubclassOf<UEquipmentDefinition> EquipmentDefinition)
+{
+	if (!EquipmentDefinition || PreloadHandles.Contains(EquipmentDefinition))
+		return;
+
+	const UEquipmentDefinition* EquipmentCDO = GetDefault<UEquipmentDefinition>(EquipmentDefinition);
+	if (AreEquipmentAssetsLoaded(EquipmentCDO))
+		return;
+
+	TArray<FSoftObjectPath> Paths;
+	GatherEquipmentAssets(EquipmentCDO, Paths);
+
+	INC_DWORD_STAT(STAT_ProEquipment_PendingLoads);
+	PreloadHandles.Add(EquipmentDefinition, UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		MoveTemp(Paths), FStreamableDelegate::CreateUObject(this, &ThisClass::OnPreloadCompleted)));
+}
+
+bool UEquipmentManagerComponent::AreEquipmentAssetsLoaded(const UEquipmentDefinition* EquipmentCDO)
+{
+	if (!EquipmentCDO)
+		return true;
+
+	for (const TObjectPtr<const UProGSCAbilitySet>& AbilitySet : EquipmentCDO->AbilitySetsToGrant)
+	{
+		if (AbilitySet && !AbilitySet->AreSoftReferencesLoaded())
+			return false;
+	}
+	return true;
+}
+
+void UEquipmentManagerComponent::GatherEquipmentAssets(const UEquipmentDefinition* EquipmentCDO, TArray<FSoftObjectPath>& OutPaths)
+{
+	// 장착 액터/애님 레이어/몽타주는 정의와 함께 이미 로드된 하드 참조이므로 어빌리티 세트의 소프트 참조만 모은다
+	if (!EquipmentCDO)
+		return;
+
+	for (const TObjectPtr<const UProGSCAbilitySet>& AbilitySet : EquipmentCDO->AbilitySetsToGrant)
+	{
+		if (AbilitySet)
+		{
+			AbilitySet->GatherSoftReferences(OutPaths);
+		}
+	}
+}
+
+void UEquipmentManagerComponent::RequestDeferredGrant(TSubclassOf<UEquipmentDefinition> EquipmentDefinition, UEquipmentInstance* Instance)
+{
+	INC_DWORD_STAT(STAT_ProEquipment_DeferredGrants);
+	INC_DWORD_STAT(STAT_ProEquipment_PendingLoads);
+
+	TArray<FSoftObjectPath> Paths;
+	GatherEquipmentAssets(GetDefault<UEquipmentDefinition>(EquipmentDefinition), Paths);
+
+	// 미리 받기 중인 경로와 겹치면 StreamableManager가 같은 요청으로 합친다
+	TSharedPtr<FStreamableHandle> Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		MoveTemp(Paths), FStreamableDelegate::CreateUObject(this, &ThisClass::OnDeferredGrantLoaded, TWeakObjectPtr<UEquipmentInstance>(Instance)));
+
+	if (Handle.IsValid() && Handle->IsLoadingInProgress())
+	{
+		DeferredGrantHandles.Add(Handle);
+	}
+}
+
+void UEquipmentManagerComponent::OnPreloadCompleted()
+{
+	DEC_DWORD_STAT(STAT_ProEquipment_PendingLoads);
+}
+
+void UEquipmentManagerComponent::OnDeferredGrantLoaded(TWeakObjectPtr<UEquipmentInstance> Instance)
+{
+	DEC_DWORD_STAT(STAT_ProEquipment_PendingLoads);
+
+	DeferredGrantHandles.RemoveAll([](const TSharedPtr<FStreamableHandle>& Handle)
+	{
+		return !Handle.IsValid() || !Handle->IsLoadingInProgress();
+	});
+
+	// 로드 중에 해제됐으면 부여하지 않는다
+	for (FEquipmentItem& Entry : EquipmentList.Items)
+	{
+		if (Entry.Instance == Instance.Get() && Entry.bGrantPending)
+		{
+			EquipmentList.GrantAbilitySets(Entry);
+			break;
+		}
+	}
+}
+
+void UEquipmentManagerComponent::CancelPendingLoads()
+{
+	for (TPair<TSubclassOf<UEquipmentDefinition>, TSharedPtr<FStreamableHandle>>& Pair : PreloadHandles)
+	{
+		if (Pair.Value.IsValid() && Pair.Value->IsLoadingInProgress())
+		{
+			DEC_DWORD_STAT(STAT_ProEquipment_PendingLoads);
+			Pair.Value->CancelHandle();
+		}
+	}
+	PreloadHandles.Empty();
+
+	for (TSharedPtr<FStreamableHandle>& Handle : DeferredGrantHandles)
+	{
+		if (Handle.IsValid() && Handle->IsLoadingInProgress())
+		{
+			DEC_DWORD_STAT(STAT_ProEquipment_PendingLoads);
+			Handle->CancelHandle();
+		}
+	}
+	DeferredGrantHandles.Empty();
+}
@@ -7,7 +7,14 @@
 #include "ProGmaeplayTag.h"
 #include "Camera/CameraComponent.h"
 #include "Character/Player/ProPlayerCharacter.h"
+#include "Engine/World.h"
+#include "Equipment/Weapon/WeaponSpreadSampler.h"
+#include "GameFramework/PlayerController.h"
 #include "GameFramework/CharacterMovementComponent.h"
+#include "Inventory/ProBulletBase.h"
+#include "Projectile/ProjectileManagerComponent.h"
+
+DEFINE_STAT(STAT_ProWeapon_AwakeInstances);
 
 URangedWeaponInstance::URangedWeaponInstance(const FObjectInitializer& ObjectInitializer)
 	:Super(ObjectInitializer)
@@ -21,43 +28,283 @@ void URangedWeaponInstance::Tick(float DeltaSecond)
 	APawn* Pawn = GetOwnerAsPawn();
 	check(Pawn);
 
-	// 탄퍼짐 구하기
-	const bool bIsMinSpread = UpdateSpread(DeltaSecond);
-	// 보정값
-	const bool bIsMinMultipliers = UpdateMultipliers(DeltaSecond);
-	
-	bHasFirstShotAccuracy = bAllowFirstShotAccuracy && bIsMinMultipliers & bIsMinSpread;
+	// OnEquipped를 거치지 않고 Tick된 경우 대비
+	if (!HeatToSpreadLUT.IsBaked())
+	{
+		BakeWeaponProfile();
+	}
+
+	// 잠든 동안에는 폰 상태만 비교하고, 바뀌었으면 깨어나 이번 프레임부터 갱신
+	if (!bAwake && ComputeSettleFingerprint(Pawn) != SettledFingerprint)
+	{
+		WakeUp();
+	}
+
+	if (bAwake)
+	{
+		// 탄퍼짐 구하기
+		const bool bIsMinSpread = UpdateSpread(DeltaSecond);
+		// 보정값
+		const bool bIsMinMultipliers = UpdateMultipliers(DeltaSecond);
+
+		bHasFirstShotAccuracy = bAllowFirstShotAccuracy && bIsMinMultipliers & bIsMinSpread;
+
+		TrySleep(Pawn, bIsMinSpread);
+	}
+
+	// 냉각 후에 이번 프레임 발사분의 열을 더한다
+	UpdateFireSchedule(DeltaSecond);
+
+	// 발사 시 게임 스레드가 트레이스를 기다리지 않도록 미리 조준점 갱신 (잠든 동안에도 계속)
+	UpdateAimTrace();
+}
+
+void URangedWeaponInstance::StartFireSchedule(const FOnRangedWeaponShotsScheduled& OnShots)
+{
+	OnScheduledShots = OnShots;
+	bFireScheduled = true;
+
+	// 직전 연사의 간격은 지키고, 충분히 쉬었다면 이번 프레임에 바로 첫 발
+	const double Now = GetWorld()->GetTimeSeconds();
+	NextShotTime = FMath::Max(NextShotTime, Now);
+
+	WakeUp();
+}
+
+void URangedWeaponInstance::StopFireSchedule()
+{
+	bFireScheduled = false;
+	OnScheduledShots.Unbind();
+}
+
+void URangedWeaponInstance::AddShotHeat(double ShotTime)
+{
+	const float HeatPerShot = HeatToHeatPerShotLUT.Eval(CurrentHeat);
+	CurrentHeat = ClampHeat(CurrentHeat + HeatPerShot);
+	CurrentSpreadAngle = HeatToSpreadLUT.Eval(CurrentHeat);
+	LastFireTime = ShotTime;
+
+	WakeUp();
+}
+
+void URangedWeaponInstance::UpdateFireSchedule(float DeltaSecond)
+{
+	if (!bFireScheduled)
+		return;
+
+	if (!OnScheduledShots.IsBound())
+	{
+		bFireScheduled = false;
+		return;
+	}
+
+	const double FrameEnd = GetWorld()->GetTimeSeconds();
+	const double FrameStart = FrameEnd - DeltaSecond;
+	const double ShotInterval = 60.0 / FMath::Max(FireRate, 1.0f);
+
+	ScheduledShots.Reset();
+	while (NextShotTime <= FrameEnd && ScheduledShots.Num() < MaxScheduledShotsPerFrame)
+	{
+		FProScheduledShot& Shot = ScheduledShots.AddDefaulted_GetRef();
+		Shot.Timestamp = NextShotTime;
+		Shot.FrameAlpha = DeltaSecond > UE_SMALL_NUMBER ? FMath::Clamp(static_cast<float>((NextShotTime - FrameStart) / DeltaSecond), 0.0f, 1.0f) : 1.0f;
+
+		NextShotTime += ShotInterval;
+	}
+
+	// 히치로 밀린 발은 따라잡지 않는다
+	NextShotTime = FMath::Max(NextShotTime, FrameEnd - ShotInterval);
+
+	if (ScheduledShots.Num() > 0)
+	{
+		// 콜백에서 StopFireSchedule이 불릴 수 있으므로 복사본으로 호출
+		const FOnRangedWeaponShotsScheduled Callback = OnScheduledShots;
+		Callback.ExecuteIfBound(ScheduledShots);
+	}
+}
+
+void URangedWeaponInstance::BeginDestroy()
+{
+	SetAwake(false);
+
+	Super::BeginDestroy();
+}
+
+void URangedWeaponInstance::WakeUp()
+{
+	SetAwake(true);
+}
+
+void URangedWeaponInstance::SetAwake(bool bNewAwake)
+{
+	if (bAwake == bNewAwake)
+		return;
+
+	bAwake = bNewAwake;
+	if (bAwake)
+	{
+		INC_DWORD_STAT(STAT_ProWeapon_AwakeInstances);
+	}
+	else
+	{
+		DEC_DWORD_STAT(STAT_ProWeapon_AwakeInstances);
+	}
+}
+
+uint8 URangedWeaponInstance::ComputeSettleFingerprint(const APawn* Pawn) const
+{
+	const UCharacterMovementComponent* CharMovementComp = Cast<UCharacterMovementComponent>(Pawn->GetMovementComponent());
+	const AProPlayerCharacter* Character = Cast<AProPlayerCharacter>(Pawn);
+
+	uint8 Fingerprint = 0;
+	if (CharMovementComp)
+	{
+		Fingerprint |= static_cast<uint8>(CharMovementComp->MovementMode) & 0x0F;
+		Fingerprint |= CharMovementComp->IsCrouching() ? 0x10 : 0;
+	}
+	Fingerprint |= (Character && Character->IsAiming) ? 0x20 : 0;
+	const float PawnSpeedSquared = Pawn->GetVelocity().SizeSquared();
+	Fingerprint |= PawnSpeedSquared > FMath::Square(StandingStillSpeedThreshold) ? 0x40 : 0;
+	Fingerprint |= PawnSpeedSquared >= FMath::Square(StandingStillSpeedThreshold + StandingStillToMovingSpeedRange) ? 0x80 : 0;
+	return Fingerprint;
+}
+
+void URangedWeaponInstance::TrySleep(const APawn* Pawn, bool bIsMinSpread)
+{
+	// 최소값이 아니라 현재 목표값에 수렴했는지로 판정 (조준/이동/공중 상태에서도 잠들 수 있음)
+	const bool bHeatSettled = CurrentHeat <= CachedMinHeat;
+	if (!bIsMinSpread || !bHeatSettled || !bMultipliersSettled)
+		return;
+
+	SettledFingerprint = ComputeSettleFingerprint(Pawn);
+	SetAwake(false);
+}
+
+bool URangedWeaponInstance::GetCachedAimPoint(FVector& OutAimPoint, int32 MaxAgeFrames) const
+{
+	if (!bHasCachedAim || GFrameCounter - CachedAimFrame > static_cast<uint64>(FMath::Max(MaxAgeFrames, 0)))
+		return false;
+
+	OutAimPoint = CachedAimPoint;
+	return true;
+}
+
+void URangedWeaponInstance::UpdateAimTrace()
+{
+	UWorld* World = GetWorld();
+	APawn* Pawn = GetOwnerAsPawn();
+	APlayerController* Controller = Pawn ? Cast<APlayerController>(Pawn->GetController()) : nullptr;
+	if (!bUseAsyncAimTrace || !World || !Controller || !Controller->IsLocalController())
+	{
+		bHasCachedAim = false;
+		return;
+	}
+
+	// 1) 지난 프레임 요청 결과
+	FTraceDatum TraceData;
+	if (PendingAimTrace.IsValid() && World->QueryTraceData(PendingAimTrace, TraceData))
+	{
+		const FHitResult* BlockingHit = TraceData.OutHits.FindByPredicate([](const FHitResult& Hit)
+		{
+			return Hit.bBlockingHit;
+		});
+
+		CachedAimPoint = BlockingHit ? BlockingHit->ImpactPoint : PendingAimTraceEnd;
+		CachedAimFrame = GFrameCounter;
+		bHasCachedAim = true;
+	}
+
+	// 2) 이번 프레임 요청. 화면 중앙 디프로젝션은 카메라 시점과 같으므로 시점 위치/방향을 그대로 사용
+	FVector ViewLocation;
+	FRotator ViewRotation;
+	Controller->GetPlayerViewPoint(ViewLocation, ViewRotation);
+
+	const FVector TraceEnd = ViewLocation + ViewRotation.Vector() * GetLineTraceRange();
+
+	FCollisionQueryParams TraceParams(SCENE_QUERY_STAT(PerformCameraCenterTrace), true);
+	TraceParams.AddIgnoredActor(Pawn);
+
+	if (bSweepAimTrace && BulletTraceSweepRadius > 0.0f)
+	{
+		PendingAimTrace = World->AsyncSweepByChannel(EAsyncTraceType::Single, ViewLocation, TraceEnd, FQuat::Identity, ECC_Visibility,
+		                                             FCollisionShape::MakeSphere(BulletTraceSweepRadius), TraceParams);
+	}
+	else
+	{
+		PendingAimTrace = World->AsyncLineTraceByChannel(EAsyncTraceType::Single, ViewLocation, TraceEnd, ECC_Visibility, TraceParams);
+	}
+	PendingAimTraceEnd = TraceEnd;
 }
 
 void URangedWeaponInstance::OnEquipped()
 {
 	K2_OnEquipped();
 
-	float MinHeatRange;
-	float MaxHeatRange;
+	// 기준 시드를 고정하면 (ShooterPro.Weapon.SpreadSeed) 같은 입력에서 탄 퍼짐이 그대로 재현됨
+	SpreadRandomStream.Initialize(FWeaponSpreadSampler::MakeStreamSeed(this, GetOwnerAsPawn()));
 
-	ComputeHeatRange(MinHeatRange, MaxHeatRange);
-	CurrentHeat = (MinHeatRange + MaxHeatRange) * 0.5f;
+	BakeWeaponProfile();
+	WakeUp();
+	CurrentHeat = (CachedMinHeat + CachedMaxHeat) * 0.5f;
 
-	CurrentSpreadAngle = HeatToSpreadCurve.GetRichCurveConst()->Eval(CurrentHeat);
+	CurrentSpreadAngle = HeatToSpreadLUT.Eval(CurrentHeat);
 
 	CurrentSpreadAngleMultiplier = 1.0f;
 	StandingStillMultiplier = 1.0f;
 	JumpFallMultiplier = 1.0f;
 	CrouchingMultiplier = 1.0f;
+	bMultipliersSettled = false;
+
+	// 전투 중 탄환 스폰이 일어나지 않도록 미리 풀을 채워 둠
+	if (PrewarmBulletClass && PrewarmBulletCount > 0)
+	{
+		if (APawn* Pawn = GetOwnerAsPawn())
+		{
+			if (UProjectileManagerComponent* ProjectileManager = Pawn->FindComponentByClass<UProjectileManagerComponent>())
+				ProjectileManager->Prewarm(PrewarmBulletClass, PrewarmBulletCount);
+		}
+	}
 }
 
 void URangedWeaponInstance::OnUnequipped()
 {
 	K2_OnUnequipped();
+
+	PendingAimTrace = FTraceHandle();
+	bHasCachedAim = false;
+
+	StopFireSchedule();
+
+	// 들고 있지 않은 무기는 깨어 있는 수에서 제외
+	SetAwake(false);
 }
 
-void URangedWeaponInstance::ComputeSpreadRange(float& MinSpread, float& MaxSpread)
+void URangedWeaponInstance::BakeWeaponProfile()
+{
+	// 키 탐색(GetTimeRange/GetValueRange)은 여기서만 한 번
+	ComputeHeatRange(CachedMinHeat, CachedMaxHeat);
+	ComputeSpreadRange(CachedMinSpread, CachedMaxSpread);
+
+	HeatToSpreadLUT.Bake(*HeatToSpreadCurve.GetRichCurveConst(), CachedMinHeat, CachedMaxHeat);
+	HeatToHeatPerShotLUT.Bake(*HeatToHeatPerShotCurve.GetRichCurveConst(), CachedMinHeat, CachedMaxHeat);
+	HeatToCoolDownPerSecondLUT.Bake(*HeatToCoolDownPerSecondCurve.GetRichCurveConst(), CachedMinHeat, CachedMaxHeat);
+}
+
+#if WITH_EDITOR
+void URangedWeaponInstance::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	BakeWeaponProfile();
+}
+#endif
+
+void URangedWeaponInstance::ComputeSpreadRange(float& MinSpread, float& MaxSpread) const
 {
 	HeatToSpreadCurve.GetRichCurveConst()->GetValueRange(/*out*/ MinSpread, /*out*/ MaxSpread);
 }
 
-void URangedWeaponInstance::ComputeHeatRange(float& MinHeat, float& MaxHeat)
+void URangedWeaponInstance::ComputeHeatRange(float& MinHeat, float& MaxHeat) const
 {
 	float Min1;
 	float Max1;
@@ -83,21 +330,15 @@ bool URangedWeaponInstance::UpdateSpread(float DeltaSecond)
 	if (TimeSinceFired > SpreadRecoveryCooldownDelay)
 	{
 		// 냉각속도 그래프에서 현재 열기에 따라 쿨다운 속도 결정
-		const float CooldownRate = HeatToCoolDownPerSecondCurve.GetRichCurve()->Eval(CurrentHeat);
+		const float CooldownRate = HeatToCoolDownPerSecondLUT.Eval(CurrentHeat);
 		// 현재 열 업데이트
 		CurrentHeat = ClampHeat(CurrentHeat - (CooldownRate * DeltaSecond));
 		// 탄 퍼짐 각도 업데이트 (이것도 커브에서 현재 열 상태를 받아서 결정)
-		CurrentSpreadAngle = HeatToSpreadCurve.GetRichCurve()->Eval(CurrentHeat);
+		CurrentSpreadAngle = HeatToSpreadLUT.Eval(CurrentHeat);
 	}
 
-	float MinSpread;
-	float MaxSpread;
-
-	//
-	ComputeSpreadRange(MinSpread, MaxSpread);
-	
 	// 퍼짐 각도가 MinSpread와 거의 다를게 없다면 true
-	return FMath::IsNearlyEqual(CurrentSpreadAngle, MinSpread, 1.e-4f);
+	return FMath::IsNearlyEqual(CurrentSpreadAngle, CachedMinSpread, 1.e-4f);
 }
 
 bool URangedWeaponInstance::UpdateMultipliers(float DeltaSeconds)
@@ -117,6 +358,9 @@ bool URangedWeaponInstance::UpdateMultipliers(float DeltaSeconds)
 	);
 	StandingStillMultiplier = FMath::FInterpTo(StandingStillMultiplier, MovementValue, DeltaSeconds, TransitionRate_StandingStill);
 	const bool bStandingStillMultiplierAtMin = FMath::IsNearlyEqual(StandingStillMultiplier, SpreadAngleMultiplier_StandingStill, SpreadAngleMultiplier_StandingStill*0.1f);
+	// 속도 구간 중간이면 목표값이 속도에 따라 계속 바뀌므로 수렴으로 보지 않는다 (핑거프린트는 양 끝만 구분)
+	const bool bMovementValueAtEdge = PawnSpeed <= StandingStillSpeedThreshold || PawnSpeed >= StandingStillSpeedThreshold + StandingStillToMovingSpeedRange;
+	const bool bStandingStillSettled = bMovementValueAtEdge && FMath::IsNearlyEqual(StandingStillMultiplier, MovementValue, KINDA_SMALL_NUMBER);
 
 	// 숙이기 보정값
 	const bool bIsCrouching = (CharMovementComp != nullptr) && CharMovementComp->IsCrouching();
@@ -129,6 +373,7 @@ bool URangedWeaponInstance::UpdateMultipliers(float DeltaSeconds)
 	const float JumpFallTargetValue = bIsJumpingOrFalling ? SpreadAngleMultiplier_JumpingOrFalling : 1.0f;
 	JumpFallMultiplier = FMath::FInterpTo(JumpFallMultiplier, JumpFallTargetValue, DeltaSeconds, TransitionRate_JumpingOrFalling);
 	const bool bJumpFallMultiplerIs1 = FMath::IsNearlyEqual(JumpFallMultiplier, 1.0f, MultiplierNearlyEqualThreshold);
+	const bool bJumpFallSettled = FMath::IsNearlyEqual(JumpFallMultiplier, JumpFallTargetValue, KINDA_SMALL_NUMBER);
 
 	// ADS 보정값 -> 태그나 카메라 가져오기.
 	float AimingAlpha = 0.0f;
@@ -156,6 +401,9 @@ bool URangedWeaponInstance::UpdateMultipliers(float DeltaSeconds)
 	const float CombinedMultiplier = AimingMultiplier * StandingStillMultiplier * CrouchingMultiplier * JumpFallMultiplier;
 	CurrentSpreadAngleMultiplier = CombinedMultiplier;
 
+	// 조준/숙이기 보정값은 보간 없이 바로 목표값이므로 보간되는 두 값만 확인
+	bMultipliersSettled = bStandingStillSettled && bJumpFallSettled;
+
 	// 4가지 조건 (가만히 있는가, 앉아있는가, 공중인가, 조준중인가)
 	return bStandingStillMultiplierAtMin && bJumpFallMultiplerIs1 && bAimingMultiplierAtTarget;
 }
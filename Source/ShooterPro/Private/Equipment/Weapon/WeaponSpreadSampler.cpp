@@ -0,0 +1,126 @@
+#include "Equipment/Weapon/WeaponSpreadSampler.h"
+
+#include "HAL/IConsoleManager.h"
+#include "Equipment/Weapon/RangedWeaponInstance.h"
+
+DECLARE_CYCLE_STAT(TEXT("Spread Sampling"), STAT_ProWeapon_SpreadSampling, STATGROUP_ProWeapon);
+
+namespace WeaponSpreadSampler
+{
+	static int32 SpreadSeed = 0;
+	static FAutoConsoleVariableRef CVarSpreadSeed(
+		TEXT("ShooterPro.Weapon.SpreadSeed"),
+		SpreadSeed,
+		TEXT("탄 퍼짐 기준 시드. 0이 아니면 이후 장착하는 무기의 탄 퍼짐이 이 값으로 결정적으로 생성됩니다."),
+		ECVF_Cheat);
+
+	static int32 SessionSeed = 0;
+}
+
+FVector FWeaponSpreadSampler::SampleCone(const FVector& Dir, float ConeHalfAngleRad, float Exponent, FRandomStream& Stream)
+{
+	// 묶음 경로와 같은 연산을 거쳐야 한 발씩 뽑아도 재현 결과가 같다
+	FVector Direction;
+	SampleConeBatch(Dir, ConeHalfAngleRad, Exponent, Stream, MakeArrayView(&Direction, 1));
+	return Direction;
+}
+
+void FWeaponSpreadSampler::SampleConeBatch(const FVector& Dir, float ConeHalfAngleRad, float Exponent, FRandomStream& Stream, TArrayView<FVector> OutDirections)
+{
+	SCOPE_CYCLE_COUNTER(STAT_ProWeapon_SpreadSampling);
+
+	const FVector Forward = Dir.GetSafeNormal();
+	if (ConeHalfAngleRad <= 0.f)
+	{
+		for (FVector& OutDirection : OutDirections)
+		{
+			OutDirection = Forward;
+		}
+		return;
+	}
+
+	// 조준 방향 기준 직교 기저를 한 번만 계산
+	FVector Right;
+	FVector Up;
+	Forward.FindBestAxisVectors(Right, Up);
+
+	const VectorRegister4Float HalfAngle = VectorSetFloat1(ConeHalfAngleRad);
+	const VectorRegister4Float ExponentV = VectorSetFloat1(Exponent);
+	const VectorRegister4Float TwoPi = VectorSetFloat1(UE_TWO_PI);
+	// Pow를 exp2(log2(x) * e)로 계산하므로 0은 피한다
+	const VectorRegister4Float MinBase = VectorSetFloat1(UE_SMALL_NUMBER);
+
+	const VectorRegister4Float ForwardX = VectorSetFloat1(static_cast<float>(Forward.X));
+	const VectorRegister4Float ForwardY = VectorSetFloat1(static_cast<float>(Forward.Y));
+	const VectorRegister4Float ForwardZ = VectorSetFloat1(static_cast<float>(Forward.Z));
+	const VectorRegister4Float RightX = VectorSetFloat1(static_cast<float>(Right.X));
+	const VectorRegister4Float RightY = VectorSetFloat1(static_cast<float>(Right.Y));
+	const VectorRegister4Float RightZ = VectorSetFloat1(static_cast<float>(Right.Z));
+	const VectorRegister4Float UpX = VectorSetFloat1(static_cast<float>(Up.X));
+	const VectorRegister4Float UpY = VectorSetFloat1(static_cast<float>(Up.Y));
+	const VectorRegister4Float UpZ = VectorSetFloat1(static_cast<float>(Up.Z));
+
+	const int32 Num = OutDirections.Num();
+	for (int32 First = 0; First < Num; First += BatchSize)
+	{
+		const int32 Count = FMath::Min(BatchSize, Num - First);
+
+		// 난수는 발 순서대로 (중심각, 회전각) 쌍으로 뽑는다. 남는 레인은 스트림을 소비하지 않음
+		alignas(16) float FromCenterRand[BatchSize] = {};
+		alignas(16) float AroundRand[BatchSize] = {};
+		for (int32 Lane = 0; Lane < Count; ++Lane)
+		{
+			FromCenterRand[Lane] = Stream.GetFraction();
+			AroundRand[Lane] = Stream.GetFraction();
+		}
+
+		const VectorRegister4Float FromCenter = VectorMultiply(VectorPow(VectorMax(VectorLoadAligned(FromCenterRand), MinBase), ExponentV), HalfAngle);
+		const VectorRegister4Float Around = VectorMultiply(VectorLoadAligned(AroundRand), TwoPi);
+
+		VectorRegister4Float SinFromCenter, CosFromCenter;
+		VectorSinCos(&SinFromCenter, &CosFromCenter, &FromCenter);
+		VectorRegister4Float SinAround, CosAround;
+		VectorSinCos(&SinAround, &CosAround, &Around);
+
+		// Forward * cos(중심각) + (Right * cos(회전각) + Up * sin(회전각)) * sin(중심각)를 성분별로
+		const VectorRegister4Float X = VectorMultiplyAdd(ForwardX, CosFromCenter, VectorMultiply(VectorMultiplyAdd(RightX, CosAround, VectorMultiply(UpX, SinAround)), SinFromCenter));
+		const VectorRegister4Float Y = VectorMultiplyAdd(ForwardY, CosFromCenter, VectorMultiply(VectorMultiplyAdd(RightY, CosAround, VectorMultiply(UpY, SinAround)), SinFromCenter));
+		const VectorRegister4Float Z = VectorMultiplyAdd(ForwardZ, CosFromCenter, VectorMultiply(VectorMultiplyAdd(RightZ, CosAround, VectorMultiply(UpZ, SinAround)), SinFromCenter));
+
+		alignas(16) float OutX[BatchSize];
+		alignas(16) float OutY[BatchSize];
+		alignas(16) float OutZ[BatchSize];
+		VectorStoreAligned(X, OutX);
+		VectorStoreAligned(Y, OutY);
+		VectorStoreAligned(Z, OutZ);
+
+		for (int32 Lane = 0; Lane < Count; ++Lane)
+		{
+			OutDirections[First + Lane] = FVector(OutX[Lane], OutY[Lane], OutZ[Lane]);
+		}
+	}
+}
+
+int32 FWeaponSpreadSampler::GetBaseSeed()
+{
+	if (WeaponSpreadSampler::SpreadSeed != 0)
+		return WeaponSpreadSampler::SpreadSeed;
+
+	if (WeaponSpreadSampler::SessionSeed == 0)
+	{
+		WeaponSpreadSampler::SessionSeed = FMath::Max(FMath::Rand(), 1);
+		UE_LOG(LogTemp, Log, TEXT("Weapon spread seed: %d (ShooterPro.Weapon.SpreadSeed %d 로 재현)"), WeaponSpreadSampler::SessionSeed, WeaponSpreadSampler::SessionSeed);
+	}
+	return WeaponSpreadSampler::SessionSeed;
+}
+
+int32 FWeaponSpreadSampler::MakeStreamSeed(const UObject* Weapon, const UObject* Owner)
+{
+	// FName 해시는 이름 테이블 인덱스(로드 순서에 따라 다름)라 실행마다 달라지므로 문자열로 해시
+	uint32 Seed = static_cast<uint32>(GetBaseSeed());
+	if (Weapon)
+		Seed = HashCombine(Seed, GetTypeHash(Weapon->GetClass()->GetPathName()));
+	if (Owner)
+		Seed = HashCombine(Seed, GetTypeHash(Owner->GetName()));
+	return static_cast<int32>(Seed);
+}
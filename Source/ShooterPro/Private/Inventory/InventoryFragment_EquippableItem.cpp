@@ -3,3 +3,18 @@
 
 #include "Inventory/InventoryFragment_EquippableItem.h"
 
+#include "Equipment/EquipmentManagerComponent.h"
+#include "Inventory/InventoryItemInstance.h"
+
+void UInventoryFragment_EquippableItem::OnInstanceCreated(UInventoryItemInstance* Instance) const
+{
+	// 아이템 인스턴스의 Outer는 인벤토리를 가진 액터
+	const AActor* OwnerActor = Instance ? Instance->GetTypedOuter<AActor>() : nullptr;
+	if (!OwnerActor)
+		return;
+
+	if (UEquipmentManagerComponent* EquipmentManager = OwnerActor->FindComponentByClass<UEquipmentManagerComponent>())
+	{
+		EquipmentManager->PreloadEquipment(EquipmentDefinition);
+	}
+}
@@ -7,10 +7,7 @@
 
 void UInventoryFragment_SetStats::OnInstanceCreated(UInventoryItemInstance* Instance) const
 {
-	for (const auto& KVP : InitialItemStats)
-	{
-		Instance->AddStatTagStack(KVP.Key, KVP.Value);
-	}
+	Instance->ApplyStatTagDeltas(InitialItemStats);
 }
 
 int32 UInventoryFragment_SetStats::GetItemStatByTag(FGameplayTag Tag) const
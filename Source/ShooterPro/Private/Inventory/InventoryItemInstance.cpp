@@ -4,8 +4,26 @@
 #include "Inventory/InventoryItemInstance.h"
 
 #include "GameplayTagContainer.h"
+#include "Net/UnrealNetwork.h"
 
 UInventoryItemInstance::UInventoryItemInstance(const FObjectInitializer& ObjectInitializer)
 	:Super(ObjectInitializer)
 {
+	if (!HasAnyFlags(RF_ClassDefaultObject))
+	{
+		StatTags.OnStackChanged.AddUObject(this, &ThisClass::HandleStatTagChanged);
+	}
+}
+
+void UInventoryItemInstance::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME(ThisClass, StatTags);
+	DOREPLIFETIME(ThisClass, ItemDef);
+}
+
+void UInventoryItemInstance::HandleStatTagChanged(FGameplayTag Tag, int32 NewCount, int32 OldCount)
+{
+	OnStatTagChanged.Broadcast(this, Tag, NewCount, OldCount);
 }
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include "Inventory/InventoryManagerComponent.h"
 #include "Inventory/InventoryItemInstance.h"
 #include "Inventory/InventoryItemDefinition.h"
+#include "Net/UnrealNetwork.h"
 
 UInventoryItemInstance* FInventoryList::AddItem(const TSubclassOf<UInventoryItemDefinition>& ItemDef, int32 StackCount)
 {
@@ -12,9 +13,14 @@ UInventoryItemInstance* FInventoryList::AddItem(const TSubclassOf<UInventoryItem
 	check(ItemDef != nullptr);
 	check(OwnerComponent);
 
-	if (Items.Contains(ItemDef))
+	const int32 ExistingIndex = FindIndex(ItemDef);
+	if (ExistingIndex != INDEX_NONE)
 	{
-		Items[ItemDef].StackCount += StackCount;
+		FInventoryItem& Item = Items[ExistingIndex];
+		const int32 OldCount = Item.StackCount;
+		Item.StackCount += StackCount;
+		MarkItemDirty(Item);
+		NotifyChanged(Item.Instance, Item.StackCount, OldCount);
 	}
 	else
 	{
@@ -30,8 +36,20 @@ UInventoryItemInstance* FInventoryList::AddItem(const TSubclassOf<UInventoryItem
 			}
 		}
 		NewItem.StackCount = StackCount;
-		Items.Add(ItemDef, NewItem);
+		NewItem.SlotOrder = NextSlotOrder++;
 		Result = NewItem.Instance;
+
+		const int32 NewIndex = Items.Add(NewItem);
+		IndexByDefinition.Add(ItemDef, NewIndex);
+		SlotOrderIndices.Add(NewIndex);
+		MarkItemDirty(Items[NewIndex]);
+
+		if (OwnerComponent->IsUsingRegisteredSubObjectList() && OwnerComponent->IsReadyForReplication())
+		{
+			OwnerComponent->AddReplicatedSubObject(Result);
+		}
+
+		NotifyChanged(Result, StackCount, 0);
 	}
 
 	return Result;
@@ -41,36 +59,161 @@ void FInventoryList::RemoveItem(const TSubclassOf<UInventoryItemDefinition>& Ite
 {
 	if (!HasEnoughItem(ItemDef, StackCount)) return;
 
-	FInventoryItem& Item = Items[ItemDef];
+	const int32 Index = FindIndex(ItemDef);
+	FInventoryItem& Item = Items[Index];
 
+	const int32 OldCount = Item.StackCount;
 	Item.StackCount -= StackCount;
 
-	if (Item.StackCount == 0)
+	UInventoryItemInstance* Instance = Item.Instance;
+	const int32 NewCount = Item.StackCount;
+	if (NewCount == 0)
+	{
+		RemoveAtIndex(Index);
+	}
+	else
 	{
-		Items.Remove(ItemDef);
+		MarkItemDirty(Item);
 	}
+
+	NotifyChanged(Instance, NewCount, OldCount);
 }
 
 void FInventoryList::EraseItem(UInventoryItemInstance* Instance)
 {
-	Items.Remove(Instance->GetItemDef());
+	if (!Instance) return;
+
+	const int32 Index = FindIndex(Instance->GetItemDef());
+	if (Index == INDEX_NONE) return;
+
+	const int32 OldCount = Items[Index].StackCount;
+	RemoveAtIndex(Index);
+	NotifyChanged(Instance, 0, OldCount);
+}
+
+void FInventoryList::RemoveAtIndex(int32 Index)
+{
+	if (UInventoryItemInstance* Instance = Items[Index].Instance)
+	{
+		IndexByDefinition.Remove(Instance->GetItemDef());
+
+		if (OwnerComponent && OwnerComponent->IsUsingRegisteredSubObjectList())
+		{
+			OwnerComponent->RemoveReplicatedSubObject(Instance);
+		}
+	}
+
+	// 순서를 유지해서 지운다 (퀵바/HUD가 보는 인덱스가 뒤섞이지 않도록). 제거는 드물므로 뒤쪽 인덱스만 다시 기록
+	Items.RemoveAt(Index, 1, EAllowShrinking::No);
+	for (int32 Shifted = Index; Shifted < Items.Num(); ++Shifted)
+	{
+		if (const UInventoryItemInstance* Instance = Items[Shifted].Instance)
+		{
+			IndexByDefinition.Add(Instance->GetItemDef(), Shifted);
+		}
+	}
+
+	SlotOrderIndices.Remove(Index);
+	for (int32& OrderedIndex : SlotOrderIndices)
+	{
+		if (OrderedIndex > Index)
+		{
+			--OrderedIndex;
+		}
+	}
+
+	MarkArrayDirty();
+}
+
+void FInventoryList::RebuildIndex()
+{
+	IndexByDefinition.Reset();
+	for (int32 Index = 0; Index < Items.Num(); ++Index)
+	{
+		if (const UInventoryItemInstance* Instance = Items[Index].Instance)
+		{
+			IndexByDefinition.Add(Instance->GetItemDef(), Index);
+		}
+	}
+
+	SlotOrderIndices.Reset(Items.Num());
+	for (int32 Index = 0; Index < Items.Num(); ++Index)
+	{
+		SlotOrderIndices.Add(Index);
+	}
+	SlotOrderIndices.StableSort([this](int32 A, int32 B)
+	{
+		return Items[A].SlotOrder < Items[B].SlotOrder;
+	});
+}
+
+void FInventoryList::NotifyChanged(UInventoryItemInstance* Instance, int32 NewCount, int32 OldCount)
+{
+	++Version;
+
+	if (UInventoryManagerComponent* InventoryComponent = Cast<UInventoryManagerComponent>(OwnerComponent))
+	{
+		InventoryComponent->OnInventoryItemChanged.Broadcast(Instance, NewCount, OldCount);
+	}
+}
+
+void FInventoryList::PreReplicatedRemove(const TArrayView<int32> RemovedIndices, int32 FinalSize)
+{
+	for (const int32 Index : RemovedIndices)
+	{
+		FInventoryItem& Item = Items[Index];
+		NotifyChanged(Item.Instance, 0, Item.StackCount);
+		Item.LastObservedCount = 0;
+	}
+}
+
+void FInventoryList::PostReplicatedAdd(const TArrayView<int32> AddedIndices, int32 FinalSize)
+{
+	for (const int32 Index : AddedIndices)
+	{
+		FInventoryItem& Item = Items[Index];
+		if (Item.Instance)
+		{
+			IndexByDefinition.Add(Item.Instance->GetItemDef(), Index);
+		}
+		NotifyChanged(Item.Instance, Item.StackCount, 0);
+		Item.LastObservedCount = Item.StackCount;
+	}
+}
+
+void FInventoryList::PostReplicatedChange(const TArrayView<int32> ChangedIndices, int32 FinalSize)
+{
+	for (const int32 Index : ChangedIndices)
+	{
+		FInventoryItem& Item = Items[Index];
+		NotifyChanged(Item.Instance, Item.StackCount, FMath::Max(Item.LastObservedCount, 0));
+		Item.LastObservedCount = Item.StackCount;
+	}
+}
+
+void FInventoryList::PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters)
+{
+	// FastArray는 제거를 스왑으로 처리하므로 Items는 그대로 두고, SlotOrder 순 인덱스와 정의 인덱스를 한 번에 다시 만든다
+	RebuildIndex();
 }
 
 bool FInventoryList::HasEnoughItem(const TSubclassOf<UInventoryItemDefinition>& ItemDef, int32 StackCount) const
 {
-	if (!Items.Contains(ItemDef))
+	const int32 Index = FindIndex(ItemDef);
+	if (Index == INDEX_NONE)
 	{
 		return false;
 	}
 
-	return Items[ItemDef].StackCount >= StackCount;
+	return Items[Index].StackCount >= StackCount;
 }
 
 int FInventoryList::GetStackCount(TSubclassOf<UInventoryItemDefinition> ItemDef)
 {
-	if (!ItemDef || !Items.Contains(ItemDef)) return 0;
+	const int32 Index = ItemDef ? FindIndex(ItemDef) : INDEX_NONE;
+	if (Index == INDEX_NONE) return 0;
 
-	return Items[ItemDef].StackCount;
+	return Items[Index].StackCount;
 }
 
 TArray<UInventoryItemInstance*> FInventoryList::GetAllItems() const
@@ -78,9 +221,9 @@ TArray<UInventoryItemInstance*> FInventoryList::GetAllItems() const
 	TArray<UInventoryItemInstance*> Results;
 	Results.Reserve(Items.Num());
 
-	for (const auto& Entry : Items)
+	for (const int32 Index : SlotOrderIndices)
 	{
-		if (Entry.Value.Instance != nullptr) Results.Add(Entry.Value.Instance);
+		if (Items[Index].Instance != nullptr) Results.Add(Items[Index].Instance);
 	}
 
 	return Results;
@@ -88,12 +231,42 @@ TArray<UInventoryItemInstance*> FInventoryList::GetAllItems() const
 
 FInventoryItem FInventoryList::FindItemByDefinition(const TSubclassOf<UInventoryItemDefinition>& ItemDef) const
 {
-	return Items.Contains(ItemDef) ? Items[ItemDef] : FInventoryItem();
+	const int32 Index = FindIndex(ItemDef);
+	return Index != INDEX_NONE ? Items[Index] : FInventoryItem();
+}
+
+UInventoryItemInstance* FInventoryList::FindInstanceByDefinition(const TSubclassOf<UInventoryItemDefinition>& ItemDef) const
+{
+	const int32 Index = FindIndex(ItemDef);
+	return Index != INDEX_NONE ? Items[Index].Instance.Get() : nullptr;
 }
 
 
 UInventoryManagerComponent::UInventoryManagerComponent(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer), InventoryList(this)
 {
+	SetIsReplicatedByDefault(true);
+	bReplicateUsingRegisteredSubObjectList = true;
+}
+
+void UInventoryManagerComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME(ThisClass, InventoryList);
+}
+
+void UInventoryManagerComponent::ReadyForReplication()
+{
+	Super::ReadyForReplication();
+
+	// 복제 준비 전에 추가된 아이템 인스턴스 등록
+	if (IsUsingRegisteredSubObjectList())
+	{
+		for (UInventoryItemInstance* Instance : InventoryList.GetAllItems())
+		{
+			AddReplicatedSubObject(Instance);
+		}
+	}
 }
 
 UInventoryItemInstance* UInventoryManagerComponent::AddItemDefinition(TSubclassOf<UInventoryItemDefinition> ItemDef, int32 StakcCount)
@@ -116,14 +289,7 @@ void UInventoryManagerComponent::EraseItemInstance(UInventoryItemInstance* ItemI
 UInventoryItemInstance* UInventoryManagerComponent::FindFirstItemInstanceByDefinition(
 	TSubclassOf<UInventoryItemDefinition> ItemDef) const
 {
-	TArray<UInventoryItemInstance*> Items = InventoryList.GetAllItems();
-
-	for (UInventoryItemInstance* Item : Items)
-	{
-		if (Item->GetItemDef() == ItemDef) return Item;
-	}
-
-	return nullptr;
+	return InventoryList.FindInstanceByDefinition(ItemDef);
 }
 
 FInventoryItem UInventoryManagerComponent::FindInventoryItemByDefinition(
@@ -161,26 +327,27 @@ void UInventoryManagerComponent::SubtractItemStackCount(TSubclassOf<UInventoryIt
 
 UInventoryItemInstance* UInventoryManagerComponent::GetItemInstanceByIndex(int32 Index) const
 {
-	// 1) 전체 아이템 목록을 배열로 얻어온다. (TArray<UInventoryItemInstance*>)
-	TArray<UInventoryItemInstance*> AllItems = InventoryList.GetAllItems();
-
-	// 2) Index가 배열 범위 내인지 체크
-	if (AllItems.IsValidIndex(Index))
-	{
-		return AllItems[Index];
-	}
-
 	// 범위를 벗어나면 nullptr 반환
-	return nullptr;
+	return InventoryList.GetInstanceAt(Index);
 }
 
 bool UInventoryManagerComponent::DoesItemExistAtIndex(int32 Index) const
 {
-	// GetItemInstanceByIndex를 재활용하여 존재 여부만 체크
-	return (GetItemInstanceByIndex(Index) != nullptr);
+	return InventoryList.GetInstanceAt(Index) != nullptr;
 }
 
 TArray<UInventoryItemInstance*> UInventoryManagerComponent::GetAllItems()
 {
 	return InventoryList.GetAllItems();
 }
+
+int32 UInventoryManagerComponent::GetNumItems() const
+{
+	return InventoryList.Num();
+}
+
+int32 UInventoryManagerComponent::GetInventoryVersion() const
+{
+	// 블루프린트는 uint32를 못 쓰므로 비트 그대로 넘김 (같은지만 비교하면 됨)
+	return static_cast<int32>(InventoryList.GetVersion());
+}
@@ -6,8 +6,10 @@
 #include "AbilitySystemComponent.h"
 #include "AbilitySystemGlobals.h"
 #include "GameplayEffect.h"
+#include "AbilitySystem/ProEffectSpecCacheSubsystem.h"
 #include "Components/SphereComponent.h"
 #include "GameFramework/ProjectileMovementComponent.h"
+#include "Projectile/ProjectileManagerComponent.h"
 
 
 // Sets default values
@@ -58,9 +60,31 @@ void AProBulletBase::ActivateBullet(AActor* Avatar, const FVector& SpawnLocation
 	
 	CollisionComp->IgnoreActorWhenMoving(AvatarActor, true);
 
+	// 수명/사거리 만료는 풀이 한꺼번에 관리 (탄환별 타이머 없음)
+	if (bPooledInUse)
+	{
+		if (UProjectileManagerComponent* Pool = OwningPool.Get())
+			Pool->NotifyBulletActivated(this, Speed);
+	}
+
 	K2_ActivateBullet(Avatar, SpawnLocation, SpawnRotation, Direction, Speed);
 }
 
+float AProBulletBase::GetCollisionRadius() const
+{
+	return CollisionComp ? CollisionComp->GetUnscaledSphereRadius() : 0.0f;
+}
+
+ECollisionChannel AProBulletBase::GetCollisionObjectType() const
+{
+	return CollisionComp ? CollisionComp->GetCollisionObjectType() : ECC_WorldDynamic;
+}
+
+FCollisionResponseContainer AProBulletBase::GetCollisionResponses() const
+{
+	return CollisionComp ? CollisionComp->GetCollisionResponseToChannels() : FCollisionResponseContainer();
+}
+
 void AProBulletBase::DeactivateBullet()
 {
 	// 눈에 안 보이도록, 충돌도 중단
@@ -68,6 +92,17 @@ void AProBulletBase::DeactivateBullet()
 	SetActorEnableCollision(false);
 	ProjectileMovement->StopMovementImmediately();
 	ProjectileMovement->Deactivate();
+
+	// 사용 중이던 탄환이면 풀에 반납
+	if (bPooledInUse)
+	{
+		bPooledInUse = false;
+
+		if (UProjectileManagerComponent* Pool = OwningPool.Get())
+			Pool->NotifyBulletDeactivated(this);
+		else if (OwningPool.IsStale())
+			Destroy(); // 풀이 먼저 사라졌다면 돌아갈 곳이 없음
+	}
 }
 
 void AProBulletBase::OnBounce_Implementation(const FHitResult& ImpactResult, const FVector& ImpactVelocity)
@@ -88,14 +123,16 @@ void AProBulletBase::OnHit_Implementation(UPrimitiveComponent* HitComp, AActor*
 		// 대상의 AbilitySystem 컴포넌트 가져오기
 		if (UAbilitySystemComponent* TargetASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(OtherActor))
 		{
-			// 이펙트Spec 생성
-			FGameplayEffectContextHandle EffectContext = TargetASC->MakeEffectContext();
-			EffectContext.AddSourceObject(this);
-			FGameplayEffectSpecHandle SpecHandle = TargetASC->MakeOutgoingSpec(DamageEffect, /*Level=*/1, EffectContext);
-
-			// 효과 적용
-			if (SpecHandle.IsValid())
-				TargetASC->ApplyGameplayEffectSpecToSelf(*SpecHandle.Data.Get());
+			// 발사자 기준으로 캐시된 Spec을 재사용하고, 탄환은 맞을 때마다 Context에 덮어쓴다
+			UAbilitySystemComponent* SourceASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(AvatarActor);
+
+			FProEffectApplication Application;
+			Application.SourceASC = SourceASC ? SourceASC : TargetASC;
+			Application.TargetASC = TargetASC;
+			Application.EffectClass = DamageEffect;
+			Application.SourceObject = AvatarActor;
+			Application.HitSourceObject = this;
+			UProEffectSpecCacheSubsystem::Apply(this, MoveTemp(Application));
 		}
 	}
 	
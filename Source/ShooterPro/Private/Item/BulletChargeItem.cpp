@@ -8,7 +8,7 @@
 #include "Inventory/InventoryItemDefinition.h"
 #include "Components/SphereComponent.h"
 #include "NiagaraSystem.h"
-#include "NiagaraFunctionLibrary.h"
+#include "System/ProFXManagerSubsystem.h"
 #include "Kismet/GameplayStatics.h"
 
 ABulletChargeItem::ABulletChargeItem()
@@ -67,8 +67,8 @@ void ABulletChargeItem::ActivateItem(AActor* Activator)
 
 	if (PickUpNiagaraSystem)
 	{
-		UNiagaraFunctionLibrary::SpawnSystemAtLocation(
-			GetWorld(),
+		UProFXManagerSubsystem::SpawnSystemAtLocation(
+			this,
 			PickUpNiagaraSystem,
 			GetActorLocation(),
 			GetActorRotation()
@@ -0,0 +1,329 @@
+#include "Projectile/BallisticSimulationSubsystem.h"
+
+#include "AbilitySystemComponent.h"
+#include "AbilitySystemGlobals.h"
+#include "GameplayEffect.h"
+#include "AbilitySystem/ProEffectSpecCacheSubsystem.h"
+#include "Async/ParallelFor.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StreamableManager.h"
+#include "Engine/World.h"
+
+DEFINE_STAT(STAT_ProProjectile_SimulatedBullets);
+DEFINE_STAT(STAT_ProProjectile_AsyncSweeps);
+
+
+bool UBallisticSimulationSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UBallisticSimulationSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// 첫 발사 프레임에 동기 로드하지 않도록 미리 비동기로 받아 둔다
+	if (!TracerMesh.IsNull())
+	{
+		TracerMeshHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(TracerMesh.ToSoftObjectPath());
+	}
+}
+
+void UBallisticSimulationSubsystem::Deinitialize()
+{
+	if (TracerMeshHandle.IsValid())
+	{
+		TracerMeshHandle->CancelHandle();
+		TracerMeshHandle.Reset();
+	}
+
+	if (IsValid(TracerActor))
+	{
+		TracerActor->Destroy();
+	}
+	TracerActor = nullptr;
+	TracerComponent = nullptr;
+
+	Super::Deinitialize();
+}
+
+TStatId UBallisticSimulationSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UBallisticSimulationSubsystem, STATGROUP_Tickables);
+}
+
+void UBallisticSimulationSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	ResolvePendingSweeps();
+	AdvanceBullets(DeltaTime);
+	IssueSweeps();
+	UpdateTracers();
+
+	SET_DWORD_STAT(STAT_ProProjectile_SimulatedBullets, NumActiveBullets);
+}
+
+void UBallisticSimulationSubsystem::FireBullet(const FProBallisticShot& Shot)
+{
+	const UWorld* World = GetWorld();
+	if (!World)
+		return;
+
+	const int32 Slot = AllocateSlot();
+
+	Positions[Slot] = Shot.Start;
+	Velocities[Slot] = Shot.Direction.GetSafeNormal() * Shot.Speed;
+	PendingPositions[Slot] = Shot.Start;
+	PendingVelocities[Slot] = Velocities[Slot];
+	GravityZs[Slot] = World->GetGravityZ() * Shot.GravityScale;
+	Radii[Slot] = FMath::Max(Shot.Radius, 0.0f);
+	CollisionChannels[Slot] = Shot.CollisionChannel;
+	CollisionResponses[Slot] = FCollisionResponseParams(Shot.CollisionResponses);
+	RemainingLifetimes[Slot] = MaxBulletLifetime;
+	PendingSweeps[Slot] = FTraceHandle();
+	Instigators[Slot] = Shot.Instigator;
+	DamageEffects[Slot] = Shot.DamageEffect;
+}
+
+int32 UBallisticSimulationSubsystem::AllocateSlot()
+{
+	int32 Slot;
+	if (FreeSlots.Num() > 0)
+	{
+		Slot = FreeSlots.Pop(EAllowShrinking::No);
+	}
+	else
+	{
+		Slot = SlotActive.Num();
+		Positions.AddZeroed();
+		Velocities.AddZeroed();
+		PendingPositions.AddZeroed();
+		PendingVelocities.AddZeroed();
+		GravityZs.AddZeroed();
+		Radii.AddZeroed();
+		CollisionChannels.Add(ECC_WorldDynamic);
+		CollisionResponses.AddDefaulted();
+		RemainingLifetimes.AddZeroed();
+		PendingSweeps.AddDefaulted();
+		Instigators.AddDefaulted();
+		DamageEffects.AddDefaulted();
+		SlotActive.Add(false);
+	}
+
+	SlotActive[Slot] = true;
+	++NumActiveBullets;
+	return Slot;
+}
+
+void UBallisticSimulationSubsystem::FreeSlot(int32 Slot)
+{
+	SlotActive[Slot] = false;
+	PendingSweeps[Slot] = FTraceHandle();
+	Instigators[Slot].Reset();
+	DamageEffects[Slot] = nullptr;
+	FreeSlots.Add(Slot);
+	--NumActiveBullets;
+}
+
+void UBallisticSimulationSubsystem::ResolvePendingSweeps()
+{
+	UWorld* World = GetWorld();
+
+	FTraceDatum TraceData;
+	for (int32 Slot = 0; Slot < SlotActive.Num(); ++Slot)
+	{
+		if (!SlotActive[Slot] || !PendingSweeps[Slot].IsValid())
+			continue;
+
+		FHitResult Hit;
+		bool bBlocked = false;
+		if (World->QueryTraceData(PendingSweeps[Slot], TraceData))
+		{
+			if (const FHitResult* BlockingHit = TraceData.OutHits.FindByPredicate([](const FHitResult& Result) { return Result.bBlockingHit; }))
+			{
+				Hit = *BlockingHit;
+				bBlocked = true;
+			}
+		}
+		else
+		{
+			// 결과가 아직 없거나 만료된 경우 이 구간만 동기 스윕으로 확인 (검사 없이 이동을 확정하면 벽을 통과함)
+			bBlocked = SweepSegment(Slot, Hit);
+		}
+
+		if (bBlocked)
+		{
+			ApplyDamage(Slot, Hit);
+			FreeSlot(Slot);
+			continue;
+		}
+
+		// 막힌 곳이 없으면 이번 구간 이동 확정
+		Positions[Slot] = PendingPositions[Slot];
+		Velocities[Slot] = PendingVelocities[Slot];
+		PendingSweeps[Slot] = FTraceHandle();
+	}
+}
+
+void UBallisticSimulationSubsystem::AdvanceBullets(float DeltaTime)
+{
+	ParallelFor(SlotActive.Num(), [this, DeltaTime](int32 Slot)
+	{
+		if (!SlotActive[Slot])
+			return;
+
+		RemainingLifetimes[Slot] -= DeltaTime;
+
+		// 중력은 Z축에만 작용. 구간 이동은 평균 속도로 적분
+		const FVector& Velocity = Velocities[Slot];
+		const FVector NewVelocity(Velocity.X, Velocity.Y, Velocity.Z + GravityZs[Slot] * DeltaTime);
+		PendingVelocities[Slot] = NewVelocity;
+		PendingPositions[Slot] = Positions[Slot] + (Velocity + NewVelocity) * (0.5f * DeltaTime);
+	});
+
+	// 수명이 다한 탄환 정리 (슬롯 반환은 게임 스레드에서)
+	for (int32 Slot = 0; Slot < SlotActive.Num(); ++Slot)
+	{
+		if (SlotActive[Slot] && RemainingLifetimes[Slot] <= 0.0f)
+		{
+			FreeSlot(Slot);
+		}
+	}
+}
+
+void UBallisticSimulationSubsystem::IssueSweeps()
+{
+	UWorld* World = GetWorld();
+
+	int32 NumSweeps = 0;
+	for (int32 Slot = 0; Slot < SlotActive.Num(); ++Slot)
+	{
+		if (!SlotActive[Slot])
+			continue;
+
+		PendingSweeps[Slot] = World->AsyncSweepByChannel(
+			EAsyncTraceType::Single,
+			Positions[Slot],
+			PendingPositions[Slot],
+			FQuat::Identity,
+			CollisionChannels[Slot],
+			FCollisionShape::MakeSphere(Radii[Slot]),
+			MakeSweepQueryParams(Slot),
+			CollisionResponses[Slot]);
+		++NumSweeps;
+	}
+
+	SET_DWORD_STAT(STAT_ProProjectile_AsyncSweeps, NumSweeps);
+}
+
+bool UBallisticSimulationSubsystem::SweepSegment(int32 Slot, FHitResult& OutHit) const
+{
+	return GetWorld()->SweepSingleByChannel(
+		OutHit,
+		Positions[Slot],
+		PendingPositions[Slot],
+		FQuat::Identity,
+		CollisionChannels[Slot],
+		FCollisionShape::MakeSphere(Radii[Slot]),
+		MakeSweepQueryParams(Slot),
+		CollisionResponses[Slot]);
+}
+
+FCollisionQueryParams UBallisticSimulationSubsystem::MakeSweepQueryParams(int32 Slot) const
+{
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(ProBallisticSweep), false);
+	QueryParams.AddIgnoredActor(Instigators[Slot].Get());
+	return QueryParams;
+}
+
+void UBallisticSimulationSubsystem::ApplyDamage(int32 Slot, const FHitResult& Hit) const
+{
+	AActor* OtherActor = Hit.GetActor();
+	const TSubclassOf<UGameplayEffect>& DamageEffect = DamageEffects[Slot];
+	if (!OtherActor || !DamageEffect)
+		return;
+
+	// AProBulletBase::OnHit과 같은 방식으로 적용
+	if (UAbilitySystemComponent* TargetASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(OtherActor))
+	{
+		// 발사자 기준으로 캐시된 Spec을 재사용
+		UAbilitySystemComponent* SourceASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(Instigators[Slot].Get());
+
+		FProEffectApplication Application;
+		Application.SourceASC = SourceASC ? SourceASC : TargetASC;
+		Application.TargetASC = TargetASC;
+		Application.EffectClass = DamageEffect;
+		Application.SourceObject = Instigators[Slot];
+		Application.SetHitResult(Hit);
+		UProEffectSpecCacheSubsystem::Apply(this, MoveTemp(Application));
+	}
+}
+
+void UBallisticSimulationSubsystem::UpdateTracers()
+{
+	UInstancedStaticMeshComponent* Tracers = GetOrCreateTracerComponent();
+	if (!Tracers)
+		return;
+
+	// 슬롯 수만큼 인스턴스를 유지하고, 비활성 슬롯은 크기 0으로 숨긴다
+	const int32 NumSlots = SlotActive.Num();
+	TracerTransforms.SetNum(NumSlots, EAllowShrinking::No);
+
+	const FVector HiddenScale = FVector::ZeroVector;
+	const FVector TracerScale(TracerLength / 100.0f, TracerWidth, TracerWidth);
+	for (int32 Slot = 0; Slot < NumSlots; ++Slot)
+	{
+		if (SlotActive[Slot])
+		{
+			TracerTransforms[Slot] = FTransform(Velocities[Slot].ToOrientationQuat(), Positions[Slot], TracerScale);
+		}
+		else
+		{
+			TracerTransforms[Slot] = FTransform(FQuat::Identity, FVector::ZeroVector, HiddenScale);
+		}
+	}
+
+	const int32 NumInstances = Tracers->GetInstanceCount();
+	if (NumInstances < NumSlots)
+	{
+		TArray<FTransform> NewInstances(TracerTransforms.GetData() + NumInstances, NumSlots - NumInstances);
+		Tracers->AddInstances(NewInstances, false, true, false);
+	}
+
+	if (NumInstances > 0)
+	{
+		Tracers->BatchUpdateInstancesTransforms(0, TArray<FTransform>(TracerTransforms.GetData(), FMath::Min(NumInstances, NumSlots)), true, true, true);
+	}
+
+	bTracersVisible = NumActiveBullets > 0;
+}
+
+UInstancedStaticMeshComponent* UBallisticSimulationSubsystem::GetOrCreateTracerComponent()
+{
+	if (TracerComponent)
+		return TracerComponent;
+
+	// 아직 로드 중이면 이번 프레임은 트레이서 없이 진행
+	UStaticMesh* Mesh = TracerMesh.Get();
+	if (!Mesh)
+		return nullptr;
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.ObjectFlags |= RF_Transient;
+	TracerActor = GetWorld()->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParams);
+	if (!TracerActor)
+		return nullptr;
+
+	TracerComponent = NewObject<UInstancedStaticMeshComponent>(TracerActor, TEXT("BallisticTracers"));
+	TracerComponent->SetStaticMesh(Mesh);
+	TracerComponent->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	TracerComponent->SetCastShadow(false);
+	TracerComponent->SetMobility(EComponentMobility::Movable);
+	TracerActor->SetRootComponent(TracerComponent);
+	TracerComponent->RegisterComponent();
+
+	return TracerComponent;
+}
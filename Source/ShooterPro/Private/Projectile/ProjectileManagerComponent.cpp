@@ -3,11 +3,17 @@
 
 #include "Projectile/ProjectileManagerComponent.h"
 #include "Inventory/ProBulletBase.h"
+#include "Projectile/BallisticSimulationSubsystem.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Live Pooled Bullets"), STAT_ProProjectile_LivePooledBullets, STATGROUP_ProProjectile);
 
 
 UProjectileManagerComponent::UProjectileManagerComponent(const FObjectInitializer& ObjectInitializer)
 	:Super(ObjectInitializer)
 {
+	// 수명 휠에 예약된 탄환이 있을 때만 Tick
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
 }
 
 void UProjectileManagerComponent::BeginPlay()
@@ -15,48 +21,184 @@ void UProjectileManagerComponent::BeginPlay()
 	Super::BeginPlay();
 }
 
-AProBulletBase* UProjectileManagerComponent::RequestBullet(TSubclassOf<AProBulletBase> BulletClass)
+void UProjectileManagerComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	// 1) BulletPool 배열에서 "비활성화된" Bullet을 찾아서 반환
-	for (AProBulletBase* Bullet : BulletPool)
+	// 대기 중인 탄환은 풀만 참조하고 있으므로 함께 정리 (사용 중인 탄환은 반납될 풀이 없으므로 비활성 상태로 남음)
+	for (TPair<TSubclassOf<AProBulletBase>, FProBulletPool>& Pair : BulletPools)
 	{
-		if (IsValid(Bullet) && Bullet->IsHidden() && BulletClass == Bullet->StaticClass()) // 혹은 Bullet->bIsActive 플래그 등
+		for (AProBulletBase* Bullet : Pair.Value.FreeBullets)
 		{
-			// 재활성화 하기 전에 원하는 초기화
-			return Bullet;
+			if (IsValid(Bullet))
+				Bullet->Destroy();
 		}
 	}
+	BulletPools.Empty();
+	LifetimeWheel = FBulletLifetimeWheel();
+	NumLiveBullets = 0;
 
-	// 2) 없으면 새로 스폰
-	if (GetWorld() && *BulletClass)
-	{
-		//ToDo:여기 수정하셔야 할수도
-		UObject* OwnerOuter = GetOuter();
-		FActorSpawnParameters SpawnParams;
-		SpawnParams.Owner = Cast<AActor>(OwnerOuter); // 풀 컴포넌트를 가진 액터를 소유자로
-		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	Super::EndPlay(EndPlayReason);
+}
 
-		if (AProBulletBase* NewBullet = GetWorld()->SpawnActor<AProBulletBase>(BulletClass, FVector::ZeroVector, FRotator::ZeroRotator, SpawnParams))
+void UProjectileManagerComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	LifetimeWheel.Advance(GetLifetimeTick(), [](const FBulletLifetimeWheel::FEntry& Entry)
+	{
+		// 이미 맞아서 반납됐거나 다시 발사된 탄환이면 Serial이 달라 무시
+		AProBulletBase* Bullet = Entry.Bullet.Get();
+		if (IsValid(Bullet) && Bullet->IsPooledInUse() && Bullet->GetActivationSerial() == Entry.Serial)
 		{
-			// 풀에 추가
-			BulletPool.Add(NewBullet);
+			Bullet->DeactivateBullet();
+		}
+	});
+
+	if (LifetimeWheel.IsEmpty())
+	{
+		SetComponentTickEnabled(false);
+	}
+
+	SET_DWORD_STAT(STAT_ProProjectile_LivePooledBullets, NumLiveBullets);
+}
+
+AProBulletBase* UProjectileManagerComponent::RequestBullet(TSubclassOf<AProBulletBase> BulletClass)
+{
+	if (!*BulletClass)
+		return nullptr;
 
-			// Bullet에게 자기 풀을 알려주고 싶다면
-			// NewBullet->SetPool(this);
+	FProBulletPool& Pool = BulletPools.FindOrAdd(BulletClass);
 
-			return NewBullet;
+	// 1) 대기 중인 탄환 꺼내기 (O(1))
+	AProBulletBase* Bullet = nullptr;
+	while (!Bullet && Pool.FreeBullets.Num() > 0)
+	{
+		Bullet = Pool.FreeBullets.Pop(EAllowShrinking::No);
+		if (!IsValid(Bullet))
+		{
+			// 레벨 전환 등으로 외부에서 파괴된 탄환
+			Bullet = nullptr;
+			--Pool.NumSpawned;
 		}
 	}
-	return nullptr;
+
+	// 2) 없으면 상한 안에서 새로 스폰
+	if (!Bullet)
+	{
+		if (MaxBulletsPerClass > 0 && Pool.NumSpawned >= MaxBulletsPerClass)
+			return nullptr;
+
+		Bullet = SpawnPooledBullet(BulletClass);
+		if (!Bullet)
+			return nullptr;
+
+		++Pool.NumSpawned;
+	}
+
+	Bullet->SetPooledInUse(true);
+	++Pool.NumInUse;
+	++NumLiveBullets;
+	Pool.HighWaterMark = FMath::Max(Pool.HighWaterMark, Pool.NumInUse);
+
+	return Bullet;
 }
 
 void UProjectileManagerComponent::ReleaseBullet(AProBulletBase* Bullet)
 {
 	if (!Bullet) return;
     
-	// Deactivate 호출 (Bullet 자체 로직)
+	// Deactivate 호출 (Bullet 자체 로직) -> NotifyBulletDeactivated로 풀에 반납됨
 	Bullet->DeactivateBullet();
+}
+
+void UProjectileManagerComponent::Prewarm(TSubclassOf<AProBulletBase> BulletClass, int32 Count)
+{
+	if (!*BulletClass || Count <= 0)
+		return;
+
+	FProBulletPool& Pool = BulletPools.FindOrAdd(BulletClass);
+
+	while (Pool.FreeBullets.Num() < Count)
+	{
+		if (MaxBulletsPerClass > 0 && Pool.NumSpawned >= MaxBulletsPerClass)
+			break;
+
+		AProBulletBase* Bullet = SpawnPooledBullet(BulletClass);
+		if (!Bullet)
+			break;
+
+		++Pool.NumSpawned;
+		Pool.FreeBullets.Add(Bullet);
+	}
+}
+
+int32 UProjectileManagerComponent::GetNumBulletsInUse(TSubclassOf<AProBulletBase> BulletClass) const
+{
+	const FProBulletPool* Pool = BulletPools.Find(BulletClass);
+	return Pool ? Pool->NumInUse : 0;
+}
+
+int32 UProjectileManagerComponent::GetHighWaterMark(TSubclassOf<AProBulletBase> BulletClass) const
+{
+	const FProBulletPool* Pool = BulletPools.Find(BulletClass);
+	return Pool ? Pool->HighWaterMark : 0;
+}
+
+void UProjectileManagerComponent::NotifyBulletActivated(AProBulletBase* Bullet, float Speed)
+{
+	const uint32 Serial = Bullet->IncrementActivationSerial();
+
+	// 사거리는 속력으로 나눠 시간으로 바꾼다 (감속이 없으므로 직선 비행 기준 정확)
+	float Lifetime = Bullet->GetMaxLifetime();
+	if (Bullet->GetMaxRange() > 0.0f && Speed > UE_KINDA_SMALL_NUMBER)
+	{
+		const float RangeTime = Bullet->GetMaxRange() / Speed;
+		Lifetime = Lifetime > 0.0f ? FMath::Min(Lifetime, RangeTime) : RangeTime;
+	}
+
+	if (Lifetime <= 0.0f)
+		return;
+
+	LifetimeWheel.SyncIfEmpty(GetLifetimeTick());
+	LifetimeWheel.Schedule(TWeakObjectPtr<AProBulletBase>(Bullet), Serial, FMath::CeilToInt64(Lifetime / LifetimeTickInterval));
+	SetComponentTickEnabled(true);
+}
+
+void UProjectileManagerComponent::NotifyBulletDeactivated(AProBulletBase* Bullet)
+{
+	// 탄환은 자신을 스폰한 정확한 클래스의 풀로 돌아감
+	FProBulletPool* Pool = BulletPools.Find(Bullet->GetClass());
+	if (!Pool)
+		return;
+
+	Pool->NumInUse = FMath::Max(Pool->NumInUse - 1, 0);
+	NumLiveBullets = FMath::Max(NumLiveBullets - 1, 0);
+	Pool->FreeBullets.Add(Bullet);
+}
+
+uint64 UProjectileManagerComponent::GetLifetimeTick() const
+{
+	const UWorld* World = GetWorld();
+	const double Now = World ? World->GetTimeSeconds() : 0.0;
+	return static_cast<uint64>(FMath::FloorToInt64(Now / FMath::Max(LifetimeTickInterval, 0.005f)));
+}
+
+AProBulletBase* UProjectileManagerComponent::SpawnPooledBullet(TSubclassOf<AProBulletBase> BulletClass)
+{
+	UWorld* World = GetWorld();
+	if (!World)
+		return nullptr;
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.Owner = GetOwner(); // 풀 컴포넌트를 가진 액터를 소유자로
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	AProBulletBase* NewBullet = World->SpawnActor<AProBulletBase>(BulletClass, FVector::ZeroVector, FRotator::ZeroRotator, SpawnParams);
+	if (!NewBullet)
+		return nullptr;
+
+	// 아직 사용 중이 아니므로 풀에 알리지 않고 비활성 상태로만 만든다
+	NewBullet->SetOwningPool(this);
+	NewBullet->DeactivateBullet();
 
-	// Bullet은 여전히 BulletPool에 포함됨 (즉, 재활성화될 때까지 대기)
-	// 여기서 추가적으로 설정할 것이 있으면 가능 (ex: 타이머 리셋 등)
+	return NewBullet;
 }
@@ -6,10 +6,11 @@
 // GAS 관련 헤더(프로젝트 구조에 따라 변경 필요)
 #include "AbilitySystemComponent.h"
 #include "GameplayEffect.h"
+#include "AbilitySystem/ProEffectSpecCacheSubsystem.h"
 
-// Niagara 스폰 함수 라이브러리
+// Niagara 스폰은 FX 매니저를 거침
 #include "AbilitySystemInterface.h"
-#include "NiagaraFunctionLibrary.h"
+#include "System/ProFXManagerSubsystem.h"
 #include "Character/Player/ProPlayerCharacter.h"
 
 ATrapActor::ATrapActor()
@@ -117,8 +118,8 @@ void ATrapActor::SpawnNiagaraFX()
 {
 	if (FireNiagaraSystem)
 	{
-		UNiagaraFunctionLibrary::SpawnSystemAtLocation(
-			GetWorld(),
+		UProFXManagerSubsystem::SpawnSystemAtLocation(
+			this,
 			FireNiagaraSystem,
 			GetActorLocation(),
 			GetActorRotation()
@@ -147,15 +148,11 @@ void ATrapActor::ApplyTrapEffect(AActor* TargetActor)
 		return;
 	}
 
-	FGameplayEffectContextHandle EffectContextHandle = ASC->MakeEffectContext();
-	FGameplayEffectSpecHandle SpecHandle = ASC->MakeOutgoingSpec(
-		TrapGameplayEffect,
-		1.0f, // GameplayEffect 레벨
-		EffectContextHandle
-	);
-
-	if (SpecHandle.IsValid())
-	{
-		ASC->ApplyGameplayEffectSpecToSelf(*SpecHandle.Data.Get());
-	}
+	// 함정은 같은 대상에게 반복 적용되므로 캐시된 Spec 사용 (즉시 적용)
+	FProEffectApplication Application;
+	Application.SourceASC = ASC;
+	Application.TargetASC = ASC;
+	Application.EffectClass = TrapGameplayEffect;
+	Application.Level = 1.0f; // GameplayEffect 레벨
+	UProEffectSpecCacheSubsystem::Apply(this, MoveTemp(Application), /*bBatched=*/false);
 }
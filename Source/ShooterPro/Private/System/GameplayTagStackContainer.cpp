@@ -3,15 +3,38 @@
 
 #include "System/GameplayTagStackContainer.h"
 #include "GameplayTagContainer.h"
+#include "Algo/BinarySearch.h"
 
 void FGameplayTagStackContainer::AddStack(FGameplayTag Tag, int32 StackCount)
 {
 	if (!Tag.IsValid()) return;
 
 	if (StackCount == 0) return;
-	
-	if (TagMap.Contains(Tag)) TagMap[Tag] += StackCount;
-	else TagMap.Add(Tag, StackCount);
+
+	// 찾기와 삽입 위치를 한 번의 탐색으로
+	const FName TagName = Tag.GetTagName();
+	const int32 LookupIndex = LowerBoundLookup(TagName);
+	if (Lookup.IsValidIndex(LookupIndex) && Lookup[LookupIndex].TagName == TagName)
+	{
+		FLookupEntry& Entry = Lookup[LookupIndex];
+		const int32 OldCount = Entry.Count;
+		Entry.Count += StackCount;
+
+		FGameplayTagStack& Stack = Stacks[Entry.StackIndex];
+		Stack.StackCount = Entry.Count;
+		MarkItemDirty(Stack);
+		OnStackChanged.Broadcast(Tag, Entry.Count, OldCount);
+		return;
+	}
+
+	FLookupEntry NewEntry;
+	NewEntry.TagName = TagName;
+	NewEntry.Count = StackCount;
+	NewEntry.StackIndex = Stacks.Emplace(Tag, StackCount);
+	MarkItemDirty(Stacks[NewEntry.StackIndex]);
+	Lookup.Insert(NewEntry, LookupIndex);
+
+	OnStackChanged.Broadcast(Tag, StackCount, 0);
 }
 
 void FGameplayTagStackContainer::RemoveStack(FGameplayTag Tag, int32 StackCount)
@@ -20,8 +43,118 @@ void FGameplayTagStackContainer::RemoveStack(FGameplayTag Tag, int32 StackCount)
 
 	if (StackCount == 0) return;
 
-	if (!TagMap.Contains(Tag)) return;
+	const int32 LookupIndex = FindLookupIndex(Tag);
+	if (LookupIndex == INDEX_NONE) return;
+
+	FLookupEntry& Entry = Lookup[LookupIndex];
+	const int32 OldCount = Entry.Count;
+	if (Entry.Count <= StackCount)
+	{
+		RemoveLookupAt(LookupIndex);
+		MarkArrayDirty();
+		OnStackChanged.Broadcast(Tag, 0, OldCount);
+	}
+	else
+	{
+		Entry.Count -= StackCount;
+
+		FGameplayTagStack& Stack = Stacks[Entry.StackIndex];
+		Stack.StackCount = Entry.Count;
+		MarkItemDirty(Stack);
+		OnStackChanged.Broadcast(Tag, Entry.Count, OldCount);
+	}
+}
+
+int32 FGameplayTagStackContainer::LowerBoundLookup(FName TagName) const
+{
+	return Algo::LowerBoundBy(Lookup, TagName, &FLookupEntry::TagName, FNameFastLess());
+}
+
+void FGameplayTagStackContainer::RemoveLookupAt(int32 LookupIndex)
+{
+	const int32 StackIndex = Lookup[LookupIndex].StackIndex;
+	Lookup.RemoveAt(LookupIndex, 1, EAllowShrinking::No);
+
+	// Stacks는 스왑으로 지우고, 자리를 옮긴 마지막 항목의 위치만 고친다
+	Stacks.RemoveAtSwap(StackIndex, 1, EAllowShrinking::No);
+	if (Stacks.IsValidIndex(StackIndex))
+	{
+		const int32 MovedLookupIndex = FindLookupIndex(Stacks[StackIndex].Tag);
+		if (MovedLookupIndex != INDEX_NONE)
+		{
+			Lookup[MovedLookupIndex].StackIndex = StackIndex;
+		}
+	}
+}
+
+void FGameplayTagStackContainer::PreReplicatedRemove(const TArrayView<int32> RemovedIndices, int32 FinalSize)
+{
+	// Stacks는 이후 엔진이 지우므로 조회 배열만 정리 (StackIndex는 PostReplicatedReceive에서 다시 맞춤)
+	for (const int32 Index : RemovedIndices)
+	{
+		const FGameplayTag Tag = Stacks[Index].Tag;
+		const int32 LookupIndex = FindLookupIndex(Tag);
+		if (LookupIndex == INDEX_NONE)
+			continue;
+
+		const int32 OldCount = Lookup[LookupIndex].Count;
+		Lookup.RemoveAt(LookupIndex, 1, EAllowShrinking::No);
+		OnStackChanged.Broadcast(Tag, 0, OldCount);
+	}
+}
+
+void FGameplayTagStackContainer::PostReplicatedAdd(const TArrayView<int32> AddedIndices, int32 FinalSize)
+{
+	for (const int32 Index : AddedIndices)
+	{
+		const FGameplayTagStack& Stack = Stacks[Index];
+		const FName TagName = Stack.Tag.GetTagName();
+		const int32 LookupIndex = LowerBoundLookup(TagName);
+
+		int32 OldCount = 0;
+		if (Lookup.IsValidIndex(LookupIndex) && Lookup[LookupIndex].TagName == TagName)
+		{
+			OldCount = Lookup[LookupIndex].Count;
+			Lookup[LookupIndex].Count = Stack.StackCount;
+			Lookup[LookupIndex].StackIndex = Index;
+		}
+		else
+		{
+			FLookupEntry NewEntry;
+			NewEntry.TagName = TagName;
+			NewEntry.Count = Stack.StackCount;
+			NewEntry.StackIndex = Index;
+			Lookup.Insert(NewEntry, LookupIndex);
+		}
 
-	if (TagMap[Tag] <= StackCount) TagMap.Remove(Tag);
-	else TagMap[Tag] -= StackCount;
+		OnStackChanged.Broadcast(Stack.Tag, Stack.StackCount, OldCount);
+	}
+}
+
+void FGameplayTagStackContainer::PostReplicatedChange(const TArrayView<int32> ChangedIndices, int32 FinalSize)
+{
+	for (const int32 Index : ChangedIndices)
+	{
+		const FGameplayTagStack& Stack = Stacks[Index];
+		const int32 LookupIndex = FindLookupIndex(Stack.Tag);
+		if (LookupIndex == INDEX_NONE)
+			continue;
+
+		const int32 OldCount = Lookup[LookupIndex].Count;
+		Lookup[LookupIndex].Count = Stack.StackCount;
+		OnStackChanged.Broadcast(Stack.Tag, Stack.StackCount, OldCount);
+	}
+}
+
+void FGameplayTagStackContainer::PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters)
+{
+	// 제거로 Stacks 순서가 바뀌었을 수 있으므로 위치만 다시 맞춘다
+	for (int32 Index = 0; Index < Stacks.Num(); ++Index)
+	{
+		const int32 LookupIndex = FindLookupIndex(Stacks[Index].Tag);
+		if (LookupIndex != INDEX_NONE)
+		{
+			Lookup[LookupIndex].StackIndex = Index;
+		}
+	}
 }
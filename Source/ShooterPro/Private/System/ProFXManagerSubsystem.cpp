@@ -0,0 +1,287 @@
+#include "System/ProFXManagerSubsystem.h"
+
+#include "NiagaraComponent.h"
+#include "NiagaraFunctionLibrary.h"
+#include "NiagaraSystem.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+
+DEFINE_STAT(STAT_ProFX_Spawned);
+DEFINE_STAT(STAT_ProFX_Reused);
+DEFINE_STAT(STAT_ProFX_Culled);
+DEFINE_STAT(STAT_ProFX_Active);
+
+
+bool UProFXManagerSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UProFXManagerSubsystem::Deinitialize()
+{
+	// 컴포넌트는 HostActor 소유이므로 함께 정리된다
+	if (IsValid(HostActor))
+	{
+		HostActor->Destroy();
+	}
+	HostActor = nullptr;
+	Pools.Empty();
+	NumActive = 0;
+	SET_DWORD_STAT(STAT_ProFX_Active, 0);
+
+	Super::Deinitialize();
+}
+
+UNiagaraComponent* UProFXManagerSubsystem::SpawnAtLocation(UNiagaraSystem* System, FVector Location, FRotator Rotation, FVector Scale)
+{
+	UNiagaraComponent* Component = AcquireComponent(System, Location);
+	if (!Component)
+		return nullptr;
+
+	Component->SetWorldLocationAndRotation(Location, Rotation);
+	Component->SetWorldScale3D(Scale);
+	Component->Activate(true);
+	return Component;
+}
+
+UNiagaraComponent* UProFXManagerSubsystem::SpawnAttached(UNiagaraSystem* System, USceneComponent* AttachToComponent, FName AttachPointName,
+                                                         FVector Location, FRotator Rotation, EAttachLocation::Type LocationType)
+{
+	if (!AttachToComponent)
+		return nullptr;
+
+	const FVector TestLocation = LocationType == EAttachLocation::KeepWorldPosition ? Location : AttachToComponent->GetSocketLocation(AttachPointName);
+	UNiagaraComponent* Component = AcquireComponent(System, TestLocation);
+	if (!Component)
+		return nullptr;
+
+	Component->AttachToComponent(AttachToComponent, FAttachmentTransformRules::KeepRelativeTransform, AttachPointName);
+	if (LocationType == EAttachLocation::KeepWorldPosition)
+	{
+		Component->SetWorldLocationAndRotation(Location, Rotation);
+	}
+	else
+	{
+		Component->SetRelativeLocationAndRotation(Location, Rotation);
+		Component->SetRelativeScale3D(FVector(1.0f));
+	}
+
+	Component->Activate(true);
+	return Component;
+}
+
+void UProFXManagerSubsystem::SpawnSystemAtLocation(const UObject* WorldContextObject, UNiagaraSystem* System, const FVector& Location, const FRotator& Rotation, const FVector& Scale)
+{
+	UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	if (!World || !System)
+		return;
+
+	if (UProFXManagerSubsystem* Subsystem = World->GetSubsystem<UProFXManagerSubsystem>())
+	{
+		Subsystem->SpawnAtLocation(System, Location, Rotation, Scale);
+		return;
+	}
+
+	UNiagaraFunctionLibrary::SpawnSystemAtLocation(World, System, Location, Rotation, Scale);
+}
+
+void UProFXManagerSubsystem::SpawnSystemAttached(UNiagaraSystem* System, USceneComponent* AttachToComponent, FName AttachPointName,
+                                                 const FVector& Location, const FRotator& Rotation, EAttachLocation::Type LocationType)
+{
+	UWorld* World = AttachToComponent ? AttachToComponent->GetWorld() : nullptr;
+	if (!World || !System)
+		return;
+
+	if (UProFXManagerSubsystem* Subsystem = World->GetSubsystem<UProFXManagerSubsystem>())
+	{
+		Subsystem->SpawnAttached(System, AttachToComponent, AttachPointName, Location, Rotation, LocationType);
+		return;
+	}
+
+	UNiagaraFunctionLibrary::SpawnSystemAttached(System, AttachToComponent, AttachPointName, Location, Rotation, LocationType, true);
+}
+
+UNiagaraComponent* UProFXManagerSubsystem::AcquireComponent(UNiagaraSystem* System, const FVector& Location)
+{
+	if (!System)
+		return nullptr;
+
+	// 1) 프레임 예산
+	if (BudgetFrame != GFrameCounter)
+	{
+		BudgetFrame = GFrameCounter;
+		SpawnsThisFrame = 0;
+	}
+
+	if (SpawnsThisFrame >= MaxSpawnsPerFrame)
+	{
+		INC_DWORD_STAT(STAT_ProFX_Culled);
+		return nullptr;
+	}
+
+	// 2) 거리/시야
+	double DistanceSquared = 0.0;
+	if (!IsRelevant(Location, DistanceSquared))
+	{
+		INC_DWORD_STAT(STAT_ProFX_Culled);
+		return nullptr;
+	}
+
+	FProFXPool& Pool = Pools.FindOrAdd(System);
+	// 레벨 스트리밍/GC로 사라진 컴포넌트 정리 (활성 수도 같이 줄인다)
+	const int32 NumInvalid = Pool.ActiveComponents.RemoveAllSwap([](const TObjectPtr<UNiagaraComponent>& Component)
+	{
+		return !IsValid(Component);
+	}, EAllowShrinking::No);
+	if (NumInvalid > 0)
+	{
+		NumActive -= NumInvalid;
+		SET_DWORD_STAT(STAT_ProFX_Active, NumActive);
+	}
+
+	// 3) 동시 재생 수: 가장 먼 인스턴스보다 가까울 때만 그것을 끊고 자리를 넘겨받는다
+	if (MaxInstancesPerSystem > 0 && Pool.ActiveComponents.Num() >= MaxInstancesPerSystem)
+	{
+		UNiagaraComponent* LeastSignificant = nullptr;
+		double LeastSignificantDistanceSquared = -1.0;
+		for (UNiagaraComponent* Active : Pool.ActiveComponents)
+		{
+			const double ActiveDistanceSquared = GetViewDistanceSquared(Active->GetComponentLocation());
+			if (ActiveDistanceSquared > LeastSignificantDistanceSquared)
+			{
+				LeastSignificantDistanceSquared = ActiveDistanceSquared;
+				LeastSignificant = Active;
+			}
+		}
+
+		if (!LeastSignificant || LeastSignificantDistanceSquared <= DistanceSquared)
+		{
+			INC_DWORD_STAT(STAT_ProFX_Culled);
+			return nullptr;
+		}
+
+		// OnSystemFinished에서 이미 반납됐을 수 있으나 ReleaseComponent는 중복 호출에 안전
+		LeastSignificant->DeactivateImmediate();
+		ReleaseComponent(LeastSignificant);
+	}
+
+	// 4) 대기 중인 컴포넌트 재사용, 없으면 생성
+	UNiagaraComponent* Component = nullptr;
+	while (Pool.FreeComponents.Num() > 0 && !Component)
+	{
+		Component = Pool.FreeComponents.Pop(EAllowShrinking::No);
+		if (!IsValid(Component))
+			Component = nullptr;
+	}
+
+	if (Component)
+	{
+		INC_DWORD_STAT(STAT_ProFX_Reused);
+	}
+	else
+	{
+		AActor* Host = GetOrCreateHostActor();
+		if (!Host)
+			return nullptr;
+
+		Component = NewObject<UNiagaraComponent>(Host);
+		Component->SetAsset(System);
+		Component->SetAutoActivate(false);
+		Component->SetAutoDestroy(false);
+		Component->OnSystemFinished.AddUniqueDynamic(this, &UProFXManagerSubsystem::OnComponentFinished);
+		Component->RegisterComponent();
+	}
+
+	Pool.ActiveComponents.Add(Component);
+	++NumActive;
+	++SpawnsThisFrame;
+
+	INC_DWORD_STAT(STAT_ProFX_Spawned);
+	SET_DWORD_STAT(STAT_ProFX_Active, NumActive);
+
+	return Component;
+}
+
+bool UProFXManagerSubsystem::IsRelevant(const FVector& Location, double& OutDistanceSquared) const
+{
+	OutDistanceSquared = TNumericLimits<double>::Max();
+
+	bool bHasView = false;
+	bool bRelevant = false;
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PlayerController = It->Get();
+		if (!PlayerController || !PlayerController->IsLocalController())
+			continue;
+
+		FVector ViewLocation;
+		FRotator ViewRotation;
+		PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+		bHasView = true;
+
+		const FVector ToLocation = Location - ViewLocation;
+		const double DistanceSquared = ToLocation.SizeSquared();
+		OutDistanceSquared = FMath::Min(OutDistanceSquared, DistanceSquared);
+
+		if (DistanceSquared > FMath::Square(CullDistance))
+			continue;
+
+		if (DistanceSquared <= FMath::Square(AlwaysRelevantDistance)
+			|| FVector::DotProduct(ToLocation.GetSafeNormal(), ViewRotation.Vector()) >= MinViewDot)
+		{
+			bRelevant = true;
+		}
+	}
+
+	// 로컬 시점이 없으면(서버 등) 판단하지 않고 재생
+	if (!bHasView)
+	{
+		OutDistanceSquared = 0.0;
+		return true;
+	}
+
+	return bRelevant;
+}
+
+double UProFXManagerSubsystem::GetViewDistanceSquared(const FVector& Location) const
+{
+	double DistanceSquared = 0.0;
+	IsRelevant(Location, DistanceSquared);
+	return DistanceSquared;
+}
+
+void UProFXManagerSubsystem::OnComponentFinished(UNiagaraComponent* Component)
+{
+	ReleaseComponent(Component);
+}
+
+void UProFXManagerSubsystem::ReleaseComponent(UNiagaraComponent* Component)
+{
+	if (!Component)
+		return;
+
+	FProFXPool* Pool = Pools.Find(Component->GetAsset());
+	if (!Pool || Pool->ActiveComponents.RemoveSingleSwap(Component, EAllowShrinking::No) == 0)
+		return;
+
+	// 붙어 있던 대상이 사라져도 컴포넌트는 HostActor 소유라 남아 있으므로 떼어서 보관
+	if (Component->GetAttachParent())
+	{
+		Component->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
+	}
+
+	Pool->FreeComponents.Add(Component);
+	--NumActive;
+	SET_DWORD_STAT(STAT_ProFX_Active, NumActive);
+}
+
+AActor* UProFXManagerSubsystem::GetOrCreateHostActor()
+{
+	if (HostActor)
+		return HostActor;
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.ObjectFlags |= RF_Transient;
+	HostActor = GetWorld()->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParams);
+	return HostActor;
+}
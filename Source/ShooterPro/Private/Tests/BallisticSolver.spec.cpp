@@ -0,0 +1,176 @@
+#include "AI/Utility/BallisticSolver.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+BEGIN_DEFINE_SPEC(FBallisticSolverSpec, "ShooterPro.AI.BallisticSolver", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+
+	static constexpr float Gravity = -980.0f;
+	static constexpr float Tolerance = 1.0f;
+
+	/** 발사 속도와 비행 시간으로 도착 위치 계산 */
+	static FVector Simulate(const FVector& Start, const FVector& Velocity, float GravityZ, float Time)
+	{
+		return Start + Velocity * Time + FVector(0.0, 0.0, 0.5 * GravityZ * Time * Time);
+	}
+
+	bool TestHits(const TCHAR* What, const FVector& Start, const FVector& Velocity, float GravityZ, float Time, const FVector& Target)
+	{
+		const FVector Arrived = Simulate(Start, Velocity, GravityZ, Time);
+		if (!Arrived.Equals(Target, Tolerance))
+		{
+			AddError(FString::Printf(TEXT("Expected '%s' to arrive at %s after %.3fs, but it was %s."), What, *Target.ToString(), Time, *Arrived.ToString()), 1);
+			return false;
+		}
+		return true;
+	}
+
+END_DEFINE_SPEC(FBallisticSolverSpec)
+
+void FBallisticSolverSpec::Define()
+{
+	Describe(TEXT("SolveArcs"), [this]()
+	{
+		It(TEXT("finds low and high arcs that both hit the target"), [this]()
+		{
+			const FVector Start(0.0, 0.0, 100.0);
+			const FVector Target(1500.0, 500.0, 300.0);
+
+			FVector LowVelocity, HighVelocity;
+			float LowTime = 0.0f, HighTime = 0.0f;
+			const int32 NumSolutions = FBallisticSolver::SolveArcs(Start, Target, 2000.0f, Gravity, LowVelocity, HighVelocity, &LowTime, &HighTime);
+
+			TestEqual(TEXT("Two solutions"), NumSolutions, 2);
+			TestEqual(TEXT("Low arc speed"), LowVelocity.Size(), 2000.0, 0.1);
+			TestEqual(TEXT("High arc speed"), HighVelocity.Size(), 2000.0, 0.1);
+			TestTrue(TEXT("High arc is steeper"), HighVelocity.Z > LowVelocity.Z);
+			TestTrue(TEXT("High arc flies longer"), HighTime > LowTime);
+			TestHits(TEXT("Low arc"), Start, LowVelocity, Gravity, LowTime, Target);
+			TestHits(TEXT("High arc"), Start, HighVelocity, Gravity, HighTime, Target);
+		});
+
+		It(TEXT("returns no solution out of range"), [this]()
+		{
+			// 최대 사거리 v²/g ≈ 1020
+			FVector LowVelocity, HighVelocity;
+			TestEqual(TEXT("Out of range"), FBallisticSolver::SolveArcs(FVector::ZeroVector, FVector(5000.0, 0.0, 0.0), 1000.0f, Gravity, LowVelocity, HighVelocity), 0);
+			TestEqual(TEXT("Zero speed"), FBallisticSolver::SolveArcs(FVector::ZeroVector, FVector(100.0, 0.0, 0.0), 0.0f, Gravity, LowVelocity, HighVelocity), 0);
+		});
+
+		It(TEXT("shoots straight without gravity"), [this]()
+		{
+			const FVector Target(300.0, 400.0, 0.0);
+
+			FVector LowVelocity, HighVelocity;
+			float LowTime = 0.0f, HighTime = 0.0f;
+			TestEqual(TEXT("One solution"), FBallisticSolver::SolveArcs(FVector::ZeroVector, Target, 1000.0f, 0.0f, LowVelocity, HighVelocity, &LowTime, &HighTime), 1);
+			TestEqual(TEXT("Flight time"), LowTime, 0.5f, KINDA_SMALL_NUMBER);
+			TestEqual(TEXT("Same time"), HighTime, LowTime);
+			TestHits(TEXT("Straight shot"), FVector::ZeroVector, LowVelocity, 0.0f, LowTime, Target);
+		});
+
+		It(TEXT("solves vertical shots with flight time"), [this]()
+		{
+			FVector LowVelocity, HighVelocity;
+			float LowTime = 0.0f, HighTime = 0.0f;
+
+			const FVector Above(0.0, 0.0, 1000.0);
+			TestEqual(TEXT("Up: one solution"), FBallisticSolver::SolveArcs(FVector::ZeroVector, Above, 2000.0f, Gravity, LowVelocity, HighVelocity, &LowTime, &HighTime), 1);
+			TestTrue(TEXT("Up: positive time"), LowTime > 0.0f);
+			TestEqual(TEXT("Up: same time"), HighTime, LowTime);
+			TestHits(TEXT("Up"), FVector::ZeroVector, LowVelocity, Gravity, LowTime, Above);
+
+			const FVector Below(0.0, 0.0, -1000.0);
+			TestEqual(TEXT("Down: one solution"), FBallisticSolver::SolveArcs(FVector::ZeroVector, Below, 500.0f, Gravity, LowVelocity, HighVelocity, &LowTime, &HighTime), 1);
+			TestTrue(TEXT("Down: aims down"), LowVelocity.Z < 0.0);
+			TestHits(TEXT("Down"), FVector::ZeroVector, LowVelocity, Gravity, LowTime, Below);
+
+			// 최고점 v²/2g ≈ 127
+			TestEqual(TEXT("Up: out of range"), FBallisticSolver::SolveArcs(FVector::ZeroVector, Above, 500.0f, Gravity, LowVelocity, HighVelocity, &LowTime, &HighTime), 0);
+		});
+	});
+
+	Describe(TEXT("Solve"), [this]()
+	{
+		It(TEXT("leads a moving target"), [this]()
+		{
+			FBallisticSolveRequest Request;
+			Request.Start = FVector(0.0, 0.0, 100.0);
+			Request.TargetLocation = FVector(2000.0, 0.0, 100.0);
+			Request.TargetVelocity = FVector(0.0, 300.0, 0.0);
+			Request.Speed = 3000.0f;
+			Request.GravityZ = Gravity;
+
+			const FBallisticSolution Solution = FBallisticSolver::Solve(Request);
+			TestTrue(TEXT("Valid"), Solution.bValid);
+			TestTrue(TEXT("Leads in the target's direction"), Solution.Velocity.Y > 0.0);
+
+			const FVector Intercept = Request.TargetLocation + Request.TargetVelocity * Solution.FlightTime;
+			TestHits(TEXT("Intercept"), Request.Start, Solution.Velocity, Request.GravityZ, Solution.FlightTime, Intercept);
+		});
+
+		It(TEXT("leads a moving target straight above"), [this]()
+		{
+			FBallisticSolveRequest Request;
+			Request.TargetLocation = FVector(0.0, 0.0, 500.0);
+			Request.TargetVelocity = FVector(0.0, 0.0, 100.0);
+			Request.Speed = 2000.0f;
+			Request.GravityZ = Gravity;
+
+			const FBallisticSolution Solution = FBallisticSolver::Solve(Request);
+			TestTrue(TEXT("Valid"), Solution.bValid);
+			TestTrue(TEXT("Positive time"), Solution.FlightTime > 0.0f);
+
+			const FVector Intercept = Request.TargetLocation + Request.TargetVelocity * Solution.FlightTime;
+			TestHits(TEXT("Intercept"), Request.Start, Solution.Velocity, Request.GravityZ, Solution.FlightTime, Intercept);
+		});
+	});
+
+	Describe(TEXT("SolveBatch"), [this]()
+	{
+		It(TEXT("matches Solve and reports timing"), [this]()
+		{
+			constexpr int32 NumRequests = 4096;
+
+			FRandomStream Stream(1234);
+			TArray<FBallisticSolveRequest> Requests;
+			Requests.SetNum(NumRequests);
+			for (FBallisticSolveRequest& Request : Requests)
+			{
+				Request.Start = FVector(0.0, 0.0, 100.0);
+				Request.TargetLocation = FVector(Stream.FRandRange(500.0f, 3000.0f), Stream.FRandRange(-1000.0f, 1000.0f), Stream.FRandRange(0.0f, 500.0f));
+				Request.TargetVelocity = FVector(Stream.FRandRange(-300.0f, 300.0f), Stream.FRandRange(-300.0f, 300.0f), 0.0);
+				Request.Speed = 3000.0f;
+				Request.GravityZ = Gravity;
+				Request.bHighArc = Stream.FRand() < 0.5f;
+			}
+
+			TArray<FBallisticSolution> Expected;
+			Expected.SetNum(NumRequests);
+			const double SerialStart = FPlatformTime::Seconds();
+			for (int32 Index = 0; Index < NumRequests; ++Index)
+			{
+				Expected[Index] = FBallisticSolver::Solve(Requests[Index]);
+			}
+			const double SerialTime = FPlatformTime::Seconds() - SerialStart;
+
+			TArray<FBallisticSolution> Solutions;
+			Solutions.SetNum(NumRequests);
+			const double BatchStart = FPlatformTime::Seconds();
+			FBallisticSolver::SolveBatch(Requests, Solutions);
+			const double BatchTime = FPlatformTime::Seconds() - BatchStart;
+
+			int32 NumMismatches = 0;
+			for (int32 Index = 0; Index < NumRequests; ++Index)
+			{
+				if (Solutions[Index].bValid != Expected[Index].bValid || !Solutions[Index].Velocity.Equals(Expected[Index].Velocity, KINDA_SMALL_NUMBER))
+					++NumMismatches;
+			}
+			TestEqual(TEXT("Batch matches Solve"), NumMismatches, 0);
+
+			AddInfo(FString::Printf(TEXT("%d requests: Solve loop %.3f ms, SolveBatch %.3f ms"), NumRequests, SerialTime * 1000.0, BatchTime * 1000.0));
+		});
+	});
+}
+
+#endif
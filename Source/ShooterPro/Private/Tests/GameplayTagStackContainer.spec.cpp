@@ -0,0 +1,125 @@
+#include "System/GameplayTagStackContainer.h"
+#include "GameplayTagsManager.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+BEGIN_DEFINE_SPEC(FGameplayTagStackContainerSpec, "ShooterPro.System.GameplayTagStackContainer", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+
+	/** 아이템 스탯 태그 수 (보통 8개 미만) */
+	static constexpr int32 NumTags = 8;
+	static constexpr int32 NumIterations = 100000;
+
+	TArray<FGameplayTag> Tags;
+
+END_DEFINE_SPEC(FGameplayTagStackContainerSpec)
+
+void FGameplayTagStackContainerSpec::Define()
+{
+	BeforeEach([this]()
+	{
+		// 등록된 태그 중 앞에서부터 사용 (프로젝트 태그 구성과 무관하게)
+		FGameplayTagContainer AllTags;
+		UGameplayTagsManager::Get().RequestAllGameplayTags(AllTags, /*OnlyIncludeDictionaryTags=*/false);
+
+		Tags.Reset();
+		for (const FGameplayTag& Tag : AllTags)
+		{
+			Tags.Add(Tag);
+			if (Tags.Num() == NumTags)
+				break;
+		}
+	});
+
+	It(TEXT("tracks counts like a map"), [this]()
+	{
+		if (Tags.Num() < NumTags)
+		{
+			AddWarning(TEXT("Not enough registered gameplay tags"));
+			return;
+		}
+
+		FGameplayTagStackContainer Container;
+		TMap<FGameplayTag, int32> Expected;
+
+		FRandomStream Stream(7);
+		for (int32 Step = 0; Step < 1000; ++Step)
+		{
+			const FGameplayTag& Tag = Tags[Stream.RandHelper(NumTags)];
+			const int32 Count = Stream.RandRange(1, 5);
+			if (Stream.FRand() < 0.6f)
+			{
+				Container.AddStack(Tag, Count);
+				Expected.FindOrAdd(Tag) += Count;
+			}
+			else
+			{
+				Container.RemoveStack(Tag, Count);
+				if (int32* ExpectedCount = Expected.Find(Tag))
+				{
+					*ExpectedCount -= Count;
+					if (*ExpectedCount <= 0)
+						Expected.Remove(Tag);
+				}
+			}
+
+			for (const FGameplayTag& CheckTag : Tags)
+			{
+				const int32* ExpectedCount = Expected.Find(CheckTag);
+				if (Container.GetStackCount(CheckTag) != (ExpectedCount ? *ExpectedCount : 0) || Container.ContainsTag(CheckTag) != (ExpectedCount != nullptr))
+				{
+					AddError(FString::Printf(TEXT("Step %d: %s has %d, expected %d"), Step, *CheckTag.ToString(), Container.GetStackCount(CheckTag), ExpectedCount ? *ExpectedCount : 0));
+					return;
+				}
+			}
+		}
+	});
+
+	It(TEXT("reports timing against a TMap baseline"), [this]()
+	{
+		if (Tags.Num() < NumTags)
+		{
+			AddWarning(TEXT("Not enough registered gameplay tags"));
+			return;
+		}
+
+		// 같은 순서의 조작(추가 -> 조회 -> 제거)을 두 구현에 똑같이 수행
+		int64 ContainerChecksum = 0;
+		const double ContainerStart = FPlatformTime::Seconds();
+		{
+			FGameplayTagStackContainer Container;
+			for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+			{
+				const FGameplayTag& Tag = Tags[Iteration % NumTags];
+				Container.AddStack(Tag, 2);
+				ContainerChecksum += Container.GetStackCount(Tags[(Iteration * 3) % NumTags]);
+				Container.RemoveStack(Tag, 1);
+			}
+		}
+		const double ContainerTime = FPlatformTime::Seconds() - ContainerStart;
+
+		int64 MapChecksum = 0;
+		const double MapStart = FPlatformTime::Seconds();
+		{
+			TMap<FGameplayTag, int32> Map;
+			for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+			{
+				const FGameplayTag& Tag = Tags[Iteration % NumTags];
+				Map.FindOrAdd(Tag) += 2;
+				const int32* Found = Map.Find(Tags[(Iteration * 3) % NumTags]);
+				MapChecksum += Found ? *Found : 0;
+				if (int32* Count = Map.Find(Tag))
+				{
+					if (--*Count <= 0)
+						Map.Remove(Tag);
+				}
+			}
+		}
+		const double MapTime = FPlatformTime::Seconds() - MapStart;
+
+		TestEqual(TEXT("Same results"), ContainerChecksum, MapChecksum);
+		AddInfo(FString::Printf(TEXT("%d tags, %d iterations: container %.3f ms, TMap %.3f ms"), NumTags, NumIterations, ContainerTime * 1000.0, MapTime * 1000.0));
+	});
+}
+
+#endif
@@ -0,0 +1,124 @@
+#include "System/GameplayTagStackContainer.h"
+#include "ProGmaeplayTag.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/CoreNet.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+BEGIN_DEFINE_SPEC(FGameplayTagStackReplicationSpec, "ShooterPro.Inventory.TagStackReplication", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+
+	/** 지속 사격 기준 연사력 (분당 600발) */
+	static constexpr double ShotsPerSecond = 10.0;
+	static constexpr int32 MagazineSize = 30;
+
+	/** FastArray 헤더: 배열 복제 키, 기준 키, 삭제 수, 변경 수 */
+	static constexpr int64 HeaderBits = 4 * 32;
+
+	FGameplayTagStackContainer Container;
+
+	/** 복제되는 Stacks 배열의 항목들 (private이라 리플렉션으로 접근) */
+	TArray<FFastArraySerializerItem*> GetStackItems()
+	{
+		const FArrayProperty* StacksProperty = FindFProperty<FArrayProperty>(FGameplayTagStackContainer::StaticStruct(), TEXT("Stacks"));
+		FScriptArrayHelper Helper(StacksProperty, StacksProperty->ContainerPtrToValuePtr<void>(&Container));
+
+		TArray<FFastArraySerializerItem*> Items;
+		for (int32 Index = 0; Index < Helper.Num(); ++Index)
+		{
+			Items.Add(reinterpret_cast<FFastArraySerializerItem*>(Helper.GetRawPtr(Index)));
+		}
+		return Items;
+	}
+
+	/** 변경된 항목 하나를 보낼 때의 비트 수 (복제 ID + 복제되는 프로퍼티) */
+	static int64 SerializeItemBits(FFastArraySerializerItem* Item)
+	{
+		FNetBitWriter Writer(nullptr, 8192);
+
+		int32 ReplicationID = Item->ReplicationID;
+		Writer << ReplicationID;
+
+		for (TFieldIterator<FProperty> It(FGameplayTagStack::StaticStruct()); It; ++It)
+		{
+			if (It->HasAnyPropertyFlags(CPF_RepSkip))
+				continue;
+
+			It->NetSerializeItem(Writer, nullptr, It->ContainerPtrToValuePtr<void>(Item));
+		}
+		return Writer.GetNumBits();
+	}
+
+END_DEFINE_SPEC(FGameplayTagStackReplicationSpec)
+
+void FGameplayTagStackReplicationSpec::Define()
+{
+	BeforeEach([this]()
+	{
+		Container = FGameplayTagStackContainer();
+		Container.AddStack(ProGameplayTags::Weapon_MagazineSize, MagazineSize);
+		Container.AddStack(ProGameplayTags::Weapon_MagazineAmmo, MagazineSize);
+		Container.AddStack(ProGameplayTags::Weapon_SpareAmmo, MagazineSize * 4);
+	});
+
+	It(TEXT("marks only the changed stack dirty"), [this]()
+	{
+		TArray<int32> KeysBefore;
+		for (const FFastArraySerializerItem* Item : GetStackItems())
+		{
+			KeysBefore.Add(Item->ReplicationKey);
+		}
+
+		Container.RemoveStack(ProGameplayTags::Weapon_MagazineAmmo, 1);
+
+		const TArray<FFastArraySerializerItem*> Items = GetStackItems();
+		int32 NumDirty = 0;
+		for (int32 Index = 0; Index < Items.Num(); ++Index)
+		{
+			NumDirty += Items[Index]->ReplicationKey != KeysBefore[Index] ? 1 : 0;
+		}
+
+		TestEqual(TEXT("Stacks unchanged in size"), Items.Num(), KeysBefore.Num());
+		TestEqual(TEXT("Dirty stacks per shot"), NumDirty, 1);
+		TestEqual(TEXT("Magazine ammo"), Container.GetStackCount(ProGameplayTags::Weapon_MagazineAmmo), MagazineSize - 1);
+	});
+
+	It(TEXT("reports bytes per second during sustained fire"), [this]()
+	{
+		int64 DeltaBits = 0;
+		int64 FullBits = 0;
+		for (int32 Shot = 0; Shot < MagazineSize - 1; ++Shot)
+		{
+			TArray<int32> KeysBefore;
+			for (const FFastArraySerializerItem* Item : GetStackItems())
+			{
+				KeysBefore.Add(Item->ReplicationKey);
+			}
+
+			Container.RemoveStack(ProGameplayTags::Weapon_MagazineAmmo, 1);
+
+			// 바뀐 항목만 보내는 FastArray와 매번 전체를 다시 보내는 경우를 비교
+			const TArray<FFastArraySerializerItem*> Items = GetStackItems();
+			DeltaBits += HeaderBits;
+			FullBits += HeaderBits;
+			for (int32 Index = 0; Index < Items.Num(); ++Index)
+			{
+				const int64 ItemBits = SerializeItemBits(Items[Index]);
+				FullBits += ItemBits;
+				if (Items[Index]->ReplicationKey != KeysBefore[Index])
+					DeltaBits += ItemBits;
+			}
+		}
+
+		const int32 NumShots = MagazineSize - 1;
+		const double DeltaBytesPerShot = DeltaBits / 8.0 / NumShots;
+		const double FullBytesPerShot = FullBits / 8.0 / NumShots;
+
+		AddInfo(FString::Printf(TEXT("Fast array: %.1f bytes/shot, %.1f bytes/s at %.0f shots/s"), DeltaBytesPerShot, DeltaBytesPerShot * ShotsPerSecond, ShotsPerSecond));
+		AddInfo(FString::Printf(TEXT("Full resend: %.1f bytes/shot, %.1f bytes/s at %.0f shots/s"), FullBytesPerShot, FullBytesPerShot * ShotsPerSecond, ShotsPerSecond));
+		AddInfo(TEXT("Payload only; bunch/packet headers and the owning sub-object header are not included."));
+
+		TestTrue(TEXT("Fast array sends less than a full resend"), DeltaBits < FullBits);
+	});
+}
+
+#endif
@@ -0,0 +1,183 @@
+#include "Equipment/Weapon/WeaponSpreadSampler.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+BEGIN_DEFINE_SPEC(FWeaponSpreadSamplerSpec, "ShooterPro.Weapon.SpreadSampler", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+
+	static constexpr int32 Seed = 20240917;
+	static constexpr float HalfAngleDegrees = 10.0f;
+
+	/** 샘플러 이전의 쿼터니언 구현 (비교 기준) */
+	static FVector SampleConeQuat(const FVector& Dir, float ConeHalfAngleRad, float Exponent, FRandomStream& Stream)
+	{
+		const float FromCenter = FMath::Pow(Stream.GetFraction(), Exponent);
+		const float AngleFromCenter = FromCenter * FMath::RadiansToDegrees(ConeHalfAngleRad);
+		const float AngleAround = Stream.GetFraction() * 360.0f;
+
+		const FRotator Rot = Dir.Rotation();
+		const FQuat DirQuat(Rot);
+		const FQuat FromCenterQuat(FRotator(AngleFromCenter, 0.0f, 0.0f));
+		const FQuat AroundQuat(FRotator(0.0f, 0.0f, AngleAround));
+		FQuat FinalDirectionQuat = DirQuat * AroundQuat * FromCenterQuat;
+		FinalDirectionQuat.Normalize();
+
+		return FinalDirectionQuat.RotateVector(FVector::ForwardVector);
+	}
+
+	/** 원뿔 중심에서 벌어진 각도를 반각으로 나눈 값 [0, 1] */
+	static double NormalizedAngle(const FVector& Forward, const FVector& Direction)
+	{
+		const double Cos = FMath::Clamp(FVector::DotProduct(Forward, Direction.GetSafeNormal()), -1.0, 1.0);
+		return FMath::Acos(Cos) / FMath::DegreesToRadians(HalfAngleDegrees);
+	}
+
+END_DEFINE_SPEC(FWeaponSpreadSamplerSpec)
+
+void FWeaponSpreadSamplerSpec::Define()
+{
+	const FVector Forward = FVector(1.0, 2.0, 0.5).GetSafeNormal();
+	const float HalfAngleRad = FMath::DegreesToRadians(HalfAngleDegrees);
+
+	Describe(TEXT("Distribution"), [this, Forward, HalfAngleRad]()
+	{
+		for (const float Exponent : {1.0f, 2.0f, 4.0f})
+		{
+			It(FString::Printf(TEXT("matches Rand^%g for the angle from center"), Exponent), [this, Forward, HalfAngleRad, Exponent]()
+			{
+				constexpr int32 NumSamples = 20000;
+
+				FRandomStream Stream(Seed);
+				TArray<FVector> Directions;
+				Directions.SetNumUninitialized(NumSamples);
+				FWeaponSpreadSampler::SampleConeBatch(Forward, HalfAngleRad, Exponent, Stream, Directions);
+
+				TArray<double> Angles;
+				Angles.Reserve(NumSamples);
+				for (const FVector& Direction : Directions)
+				{
+					Angles.Add(NormalizedAngle(Forward, Direction));
+				}
+				Angles.Sort();
+
+				// 중심각 a = Rand^e 의 누적분포 F(a) = a^(1/e)와 콜모고로프-스미르노프 거리 비교
+				double MaxDistance = 0.0;
+				for (int32 Index = 0; Index < NumSamples; ++Index)
+				{
+					const double Expected = FMath::Pow(FMath::Clamp(Angles[Index], 0.0, 1.0), 1.0 / Exponent);
+					MaxDistance = FMath::Max(MaxDistance, FMath::Abs(Expected - static_cast<double>(Index) / NumSamples));
+					MaxDistance = FMath::Max(MaxDistance, FMath::Abs(Expected - static_cast<double>(Index + 1) / NumSamples));
+				}
+
+				// 유의수준 0.001의 임계값 1.95 / √N
+				const double Critical = 1.95 / FMath::Sqrt(static_cast<double>(NumSamples));
+				AddInfo(FString::Printf(TEXT("KS distance %.5f (critical %.5f)"), MaxDistance, Critical));
+				TestTrue(TEXT("KS distance below critical value"), MaxDistance < Critical);
+				TestTrue(TEXT("Stays inside the cone"), Angles.Last() <= 1.0 + 1.e-3);
+			});
+		}
+
+		It(TEXT("spreads evenly around the center"), [this, Forward, HalfAngleRad]()
+		{
+			constexpr int32 NumSamples = 20000;
+			constexpr int32 NumBins = 8;
+
+			FRandomStream Stream(Seed);
+			TArray<FVector> Directions;
+			Directions.SetNumUninitialized(NumSamples);
+			FWeaponSpreadSampler::SampleConeBatch(Forward, HalfAngleRad, 1.0f, Stream, Directions);
+
+			FVector Right, Up;
+			Forward.FindBestAxisVectors(Right, Up);
+
+			int32 Bins[NumBins] = {};
+			for (const FVector& Direction : Directions)
+			{
+				const double Around = FMath::Atan2(FVector::DotProduct(Direction, Up), FVector::DotProduct(Direction, Right)) + UE_DOUBLE_PI;
+				++Bins[FMath::Clamp(static_cast<int32>(Around / UE_DOUBLE_TWO_PI * NumBins), 0, NumBins - 1)];
+			}
+
+			// 자유도 7의 카이제곱 임계값 (유의수준 0.001)
+			const double ExpectedPerBin = static_cast<double>(NumSamples) / NumBins;
+			double ChiSquare = 0.0;
+			for (const int32 Count : Bins)
+			{
+				ChiSquare += FMath::Square(Count - ExpectedPerBin) / ExpectedPerBin;
+			}
+			AddInfo(FString::Printf(TEXT("Chi-square %.3f"), ChiSquare));
+			TestTrue(TEXT("Chi-square below critical value"), ChiSquare < 24.32);
+		});
+	});
+
+	Describe(TEXT("Determinism"), [this, Forward, HalfAngleRad]()
+	{
+		It(TEXT("gives the same directions one by one and in batches"), [this, Forward, HalfAngleRad]()
+		{
+			constexpr int32 NumSamples = 37; // 묶음 크기의 배수가 아닌 수
+
+			FRandomStream BatchStream(Seed);
+			TArray<FVector> Batched;
+			Batched.SetNumUninitialized(NumSamples);
+			FWeaponSpreadSampler::SampleConeBatch(Forward, HalfAngleRad, 2.0f, BatchStream, Batched);
+
+			FRandomStream SingleStream(Seed);
+			for (int32 Index = 0; Index < NumSamples; ++Index)
+			{
+				const FVector Single = FWeaponSpreadSampler::SampleCone(Forward, HalfAngleRad, 2.0f, SingleStream);
+				if (!Single.Equals(Batched[Index], 0.0))
+				{
+					AddError(FString::Printf(TEXT("Sample %d differs: single %s, batch %s"), Index, *Single.ToString(), *Batched[Index].ToString()));
+					return;
+				}
+			}
+
+			TestEqual(TEXT("Streams consumed equally"), SingleStream.GetCurrentSeed(), BatchStream.GetCurrentSeed());
+		});
+
+		It(TEXT("repeats with the same seed"), [this, Forward, HalfAngleRad]()
+		{
+			FRandomStream StreamA(Seed);
+			FRandomStream StreamB(Seed);
+			TArray<FVector> A, B;
+			A.SetNumUninitialized(16);
+			B.SetNumUninitialized(16);
+			FWeaponSpreadSampler::SampleConeBatch(Forward, HalfAngleRad, 1.0f, StreamA, A);
+			FWeaponSpreadSampler::SampleConeBatch(Forward, HalfAngleRad, 1.0f, StreamB, B);
+			TestTrue(TEXT("Same directions"), A == B);
+		});
+	});
+
+	Describe(TEXT("Performance"), [this, Forward, HalfAngleRad]()
+	{
+		It(TEXT("reports batch vs quaternion timing"), [this, Forward, HalfAngleRad]()
+		{
+			constexpr int32 NumSamples = 1 << 16;
+
+			TArray<FVector> Directions;
+			Directions.SetNumUninitialized(NumSamples);
+
+			FRandomStream QuatStream(Seed);
+			const double QuatStart = FPlatformTime::Seconds();
+			for (FVector& Direction : Directions)
+			{
+				Direction = SampleConeQuat(Forward, HalfAngleRad, 2.0f, QuatStream);
+			}
+			const double QuatTime = FPlatformTime::Seconds() - QuatStart;
+
+			FRandomStream BatchStream(Seed);
+			const double BatchStart = FPlatformTime::Seconds();
+			FWeaponSpreadSampler::SampleConeBatch(Forward, HalfAngleRad, 2.0f, BatchStream, Directions);
+			const double BatchTime = FPlatformTime::Seconds() - BatchStart;
+
+			// 두 구현은 같은 난수 쌍을 같은 분포로 쓰므로 중심각은 같아야 한다 (회전각의 기준축만 다름)
+			FRandomStream CheckStream(Seed);
+			const FVector QuatDirection = SampleConeQuat(Forward, HalfAngleRad, 2.0f, CheckStream);
+			TestEqual(TEXT("Same angle from center"), NormalizedAngle(Forward, QuatDirection), NormalizedAngle(Forward, Directions[0]), 1.e-3);
+
+			AddInfo(FString::Printf(TEXT("%d samples: quaternion %.3f ms, batch %.3f ms (x%.2f)"),
+				NumSamples, QuatTime * 1000.0, BatchTime * 1000.0, BatchTime > 0.0 ? QuatTime / BatchTime : 0.0));
+		});
+	});
+}
+
+#endif
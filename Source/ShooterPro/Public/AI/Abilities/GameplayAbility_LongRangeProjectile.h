@@ -63,6 +63,10 @@ public:
 	UPROPERTY(EditDefaultsOnly, Category="Ability|Projectile")
 	FName MuzzleSocketName = TEXT("MuzzleSocket");
 
+	// 대상의 현재 속도로 비행 시간 뒤 위치를 예측해서 조준
+	UPROPERTY(EditDefaultsOnly, Category="Ability|Projectile")
+	bool bLeadTarget = true;
+
 	// 실제 던질 때 위로 들어줄 각도 (SuggestProjectileVelocity 사용 시 크게 의미 없을 수 있음)
 	// UPROPERTY(EditDefaultsOnly, Category="Ability|Projectile")
 	// float ThrowPitchOffset = 30.0f;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "AI/Interfaces/Interface_PooledActor.h"
 #include "GameFramework/Actor.h"
 #include "EnemyProjectile.generated.h"
 
@@ -12,7 +13,7 @@ class UProjectileMovementComponent;
 class USphereComponent;
 
 UCLASS()
-class SHOOTERPRO_API AEnemyProjectile : public AActor
+class SHOOTERPRO_API AEnemyProjectile : public AActor, public IInterface_PooledActor
 {
 	GENERATED_BODY()
 
@@ -33,6 +34,12 @@ protected:
 public:
 	FORCEINLINE UProjectileMovementComponent* GetProjectileMovement() const { return ProjectileMovement; }
 
+	//~ Begin IInterface_PooledActor interface
+	virtual void OnAcquiredFromPool() override;
+	virtual void OnReleasedToPool() override;
+	virtual float GetPooledLifeSpan() const override { return PooledLifeSpan; }
+	//~ End IInterface_PooledActor interface
+
 protected:
 	// 1) 충돌 담당
 	UPROPERTY(VisibleDefaultsOnly, Category="Enemy Projectile")
@@ -70,6 +77,10 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category="Enemy Projectile|Effects|Gameplay")
 	TSubclassOf<UGameplayEffect> DeBuffEffectClass;
 
+	// 아무것도 맞히지 못했을 때 풀로 돌아가기까지의 시간
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category="Enemy Projectile")
+	float PooledLifeSpan = 10.0f;
+
 	// // [벽/바닥 충돌 시] AoE 액터
 	// UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category="Enemy Projectile|Effects|Gameplay")
 	// TSubclassOf<AProjectileAOEActor> AOEActorClass;
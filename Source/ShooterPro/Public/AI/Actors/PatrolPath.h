@@ -6,6 +6,25 @@
 
 class USplineComponent;
 
+/**
+ * 순찰 경로 위에서 AI 한 명이 어디까지 왔는지를 나타내는 커서
+ * - 경로 액터가 아닌 AI 쪽에 저장되므로, 하나의 경로를 여러 AI가 공유해도 서로의 인덱스를 건드리지 않는다.
+ */
+USTRUCT(BlueprintType)
+struct SHOOTERPRO_API FPatrolRouteCursor
+{
+	GENERATED_BODY()
+
+public:
+	/** 현재 목표로 하고 있는 순찰 포인트 인덱스 */
+	UPROPERTY(BlueprintReadWrite, Category="Patrol|Cursor")
+	int32 PatrolIndex = 0;
+
+	/** 역방향으로 진행 중인지 여부 (닫힌 루프가 아닐 때 왕복에 사용) */
+	UPROPERTY(BlueprintReadWrite, Category="Patrol|Cursor")
+	bool bReverseDirection = false;
+};
+
 UCLASS()
 class SHOOTERPRO_API APatrolPath : public AActor
 {
@@ -15,17 +34,63 @@ public:
 	APatrolPath();
 
 protected:
+	virtual void PostInitializeComponents() override;
+
 	virtual void BeginPlay() override;
 
 	virtual void OnConstruction(const FTransform& Transform) override;
 
 public:
+	/** 공유 인덱스(PatrolIndex)를 한 칸 진행한다. 여러 AI가 경로를 공유한다면 AdvancePatrolCursor를 사용할 것 */
 	UFUNCTION(BlueprintCallable, Category="Patrol|Path")
 	void IncrementPatrolRoute();
 
+	/** 공유 인덱스(PatrolIndex)에 해당하는 순찰 포인트의 월드 위치 */
 	UFUNCTION(BlueprintCallable, Category="Patrol|Path")
 	FVector GetSplinePointAsWorldPosition();
 
+	//=============================================================================
+	// 베이크된 순찰 경로 (스플라인 평가 없이 사용)
+	//=============================================================================
+public:
+	/** 스플라인을 월드 공간 포인트와 누적 거리로 베이크한다. OnConstruction / PostInitializeComponents에서 자동 호출 */
+	UFUNCTION(BlueprintCallable, Category="Patrol|Path")
+	void BakePatrolRoute();
+
+	/** 커서를 다음 순찰 포인트로 진행시킨다 (닫힌 루프면 순환, 아니면 왕복) */
+	UFUNCTION(BlueprintCallable, Category="Patrol|Path")
+	void AdvancePatrolCursor(UPARAM(ref) FPatrolRouteCursor& Cursor) const;
+
+	/** 커서가 가리키는 순찰 포인트의 월드 위치 */
+	UFUNCTION(BlueprintPure, Category="Patrol|Path")
+	FVector GetPatrolCursorLocation(const FPatrolRouteCursor& Cursor) const;
+
+	/** 인덱스에 해당하는 순찰 포인트의 월드 위치 (범위를 벗어나면 가장 가까운 끝 포인트) */
+	UFUNCTION(BlueprintPure, Category="Patrol|Path")
+	FVector GetPatrolPointLocation(int32 PointIndex) const;
+
+	UFUNCTION(BlueprintPure, Category="Patrol|Path")
+	int32 GetNumPatrolPoints() const { return PatrolPoints.Num(); }
+
+	UFUNCTION(BlueprintPure, Category="Patrol|Path")
+	float GetRouteLength() const { return RouteLength; }
+
+	/**
+	 * 경로 위에서 주어진 위치와 가장 가까운 지점을 찾는다.
+	 * @param OutDistanceAlongRoute 경로 시작점부터 가장 가까운 지점까지의 누적 거리
+	 * @param OutNextPointIndex     가장 가까운 지점 바로 다음(정방향)의 순찰 포인트 인덱스
+	 * @return 경로 위의 가장 가까운 월드 위치
+	 */
+	UFUNCTION(BlueprintCallable, Category="Patrol|Path")
+	FVector FindNearestPointOnRoute(const FVector& WorldLocation, float& OutDistanceAlongRoute, int32& OutNextPointIndex) const;
+
+	/** 주어진 위치에서 가장 가까운 순찰 포인트를 향하도록 커서를 초기화한다 */
+	UFUNCTION(BlueprintCallable, Category="Patrol|Path")
+	void ResetCursorToNearestPoint(const FVector& WorldLocation, UPARAM(ref) FPatrolRouteCursor& Cursor) const;
+
+private:
+	bool IsBaked() const { return PatrolPoints.Num() > 0; }
+
 public:
 	virtual void Tick(float DeltaTime) override;
 
@@ -44,4 +109,31 @@ public:
 
 	UPROPERTY(BlueprintReadWrite, Category="Patrol|Path")
 	bool bPatrolReverseDirection;
+
+	/** 가장 가까운 지점 검색에 사용할 베이크 샘플 간격 (cm) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Patrol|Bake", meta=(ClampMin="10.0"))
+	float RouteSampleSpacing = 100.0f;
+
+private:
+	/** 스플라인 포인트(순찰 목표)의 월드 위치 */
+	UPROPERTY(Transient)
+	TArray<FVector> PatrolPoints;
+
+	/** 각 순찰 포인트까지의 누적 거리 */
+	UPROPERTY(Transient)
+	TArray<float> PatrolPointDistances;
+
+	/** 스플라인을 RouteSampleSpacing 간격으로 샘플링한 월드 위치 (폴리라인) */
+	UPROPERTY(Transient)
+	TArray<FVector> RouteSamples;
+
+	/** 각 샘플까지의 누적 거리 */
+	UPROPERTY(Transient)
+	TArray<float> RouteSampleDistances;
+
+	UPROPERTY(Transient)
+	float RouteLength = 0.0f;
+
+	UPROPERTY(Transient)
+	bool bClosedLoop = false;
 };
@@ -2,6 +2,8 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "AI/Interfaces/Interface_PooledActor.h"
+#include "AI/Subsystems/AoEZoneSubsystem.h"
 #include "GameFramework/Actor.h"
 #include "ProjectileAOEActor.generated.h"
 
@@ -9,7 +11,7 @@ class UGameplayEffect;
 class USphereComponent;
 
 UCLASS()
-class SHOOTERPRO_API AProjectileAOEActor : public AActor
+class SHOOTERPRO_API AProjectileAOEActor : public AActor, public IInterface_PooledActor
 {
 	GENERATED_BODY()
 
@@ -17,12 +19,19 @@ public:
 	// Sets default values for this actor's properties
 	AProjectileAOEActor();
 
+	//~ Begin IInterface_PooledActor interface
+	virtual void OnAcquiredFromPool() override;
+	virtual void OnReleasedToPool() override;
+	virtual float GetPooledLifeSpan() const override { return AoeDuration; }
+	//~ End IInterface_PooledActor interface
+
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
-	UFUNCTION()
-	void OnOverlapBegin(UPrimitiveComponent* OverlappedComp, AActor* OtherActor, UPrimitiveComponent* OtherComp,
-	                    int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
+	// 피해 판정은 오버랩 이벤트 대신 UAoEZoneSubsystem의 주기적 질의로 처리
+	void RegisterZone();
+	void UnregisterZone();
 
 	// AoE 종료
 	void DestroyAOE();
@@ -31,6 +40,7 @@ protected:
 	UPROPERTY(VisibleAnywhere, Category="Projectile AOE|Collision")
 	USceneComponent* SceneComponent;
 	
+	// 범위 표시용 (충돌 없음). 반경이 장판 반경으로 쓰인다
 	UPROPERTY(VisibleAnywhere, Category="Projectile AOE|Collision")
 	USphereComponent* AOETriggerSphere;
 
@@ -42,5 +52,11 @@ protected:
 	UPROPERTY(EditDefaultsOnly, Category="Projectile AOE|AOE")
 	float AoeDuration;
 
+	// 범위 안에 있는 대상에게 Debuff를 다시 적용하는 간격 (0이면 들어올 때 한 번만)
+	UPROPERTY(EditDefaultsOnly, Category="Projectile AOE|AOE", meta=(ClampMin=0))
+	float DamageInterval = 0.0f;
+
 	FTimerHandle AoeTimerHandle;
+
+	FProAoEZoneHandle ZoneHandle;
 };
@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "AI/AIDectionInfoTypes.h"
 #include "AI/EnemyAITypes.h"
+#include "AI/Actors/PatrolPath.h"
 #include "Components/ActorComponent.h"
 #include "ProAIBehaviorsComponent.generated.h"
 
@@ -101,6 +102,23 @@ public:
 	UFUNCTION()
 	void SetStateAsSeeking();
 
+	// 순찰 (경로는 공유, 커서는 AI마다 개별 보관)
+public:
+	/** 현재 순찰 커서가 가리키는 목표 위치. 순찰 경로가 없으면 자신의 위치 */
+	UFUNCTION(BlueprintCallable, Category="AI Behavior|Patrol")
+	FVector GetPatrolLocation() const;
+
+	/** 순찰 커서를 다음 포인트로 진행 */
+	UFUNCTION(BlueprintCallable, Category="AI Behavior|Patrol")
+	void AdvancePatrol();
+
+	/** 현재 위치에서 가장 가까운 순찰 포인트부터 다시 순찰하도록 커서 초기화 */
+	UFUNCTION(BlueprintCallable, Category="AI Behavior|Patrol")
+	void ResetPatrolToNearestPoint();
+
+private:
+	APatrolPath* GetPatrolRoute() const;
+
 	// Getters
 public:
 	UFUNCTION(BlueprintPure, Category="AI Behavior|Getter")
@@ -160,6 +178,10 @@ public:
 	UPROPERTY(BlueprintReadOnly, Category="AI Behavior|Combat")
 	TArray<AActor*> AttackableTargets;
 
+	/** 이 AI의 순찰 진행 상태 */
+	UPROPERTY(BlueprintReadWrite, Category="AI Behavior|Patrol")
+	FPatrolRouteCursor PatrolCursor;
+
 private:
 	//공격 거리
 	UPROPERTY(EditAnywhere, Category="AI Behavior")
@@ -5,12 +5,23 @@
 #include "BehaviorTree/Decorators/BTDecorator_BlackboardBase.h"
 #include "BTDecorator_CheckDistanceToTarget.generated.h"
 
+/** 데코레이터 인스턴스(AI)별 메모리 */
+struct FBTCheckDistanceToTargetMemory
+{
+	/** UDistanceBandSubsystem에 등록된 밴드 핸들 */
+	int32 BandHandle = INDEX_NONE;
+
+	/** 마지막으로 판정된 안/밖 상태 (히스테리시스 기준) */
+	bool bInside = false;
+};
 
 /**
  * 데코레이터:
  *  - Player(또는 TargetActor)와의 거리를 블랙보드 상에서 확인
  *  - 일정 거리 이하인지(또는 이상인지) 판별
  *  - FlowAbortMode & OnBlackboardKeyValueChange 로직을 통해 즉시 Abort/재실행
+ *  - bMonitorDistance가 켜져 있으면 UDistanceBandSubsystem에 등록되어,
+ *    AI나 타겟이 움직여 임계값을 넘는 프레임에 바로 Abort/재실행
  */
 UCLASS()
 class SHOOTERPRO_API UBTDecorator_CheckDistanceToTarget : public UBTDecorator_BlackboardBase
@@ -24,11 +35,22 @@ protected:
 	
 	virtual void OnBecomeRelevant(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) override;
 	virtual void OnCeaseRelevant(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) override;
+
+	virtual uint16 GetInstanceMemorySize() const override { return sizeof(FBTCheckDistanceToTargetMemory); }
+	virtual void InitializeMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryInit::Type InitType) const override;
+	virtual void CleanupMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryClear::Type CleanupType) const override;
 	
 	/** 셀프 액터와 타겟 액터 간의 거리를 비교 */
 	virtual bool CalculateRawConditionValue(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) const override;
 
 	EBlackboardNotificationResult OnBBValueChanged(const UBlackboardComponent& BlackboardComponent, FBlackboard::FKey Key, UBehaviorTreeComponent* BehaviorTreeComponent, unsigned char* Arg);
+
+	/** 블랙보드에서 타겟 액터와 임계 거리를 읽어온다 */
+	bool GetTargetAndThreshold(const UBlackboardComponent& BlackboardComp, AActor*& OutTargetActor, float& OutThreshold) const;
+
+	/** 거리 밴드 모니터에 등록/해제 */
+	void RegisterDistanceBand(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory);
+	void UnregisterDistanceBand(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) const;
 	
 protected:
 	/** 블랙보드에서 가져올 액터의 키 */
@@ -47,6 +69,13 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Distance",meta=(EditCondition="bUseCustomDistance"))
 	float CustomDistance = 500.0f;
 
+	/** AI/타겟의 이동을 매 프레임 감시하여 임계값을 넘으면 즉시 재평가할지 여부 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Distance")
+	bool bMonitorDistance = true;
+
+	/** 안쪽에 있던 타겟은 임계값 + Hysteresis를 넘어야 밖으로 판정 (경계 떨림 방지) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Distance", meta=(ClampMin="0.0"))
+	float DistanceHysteresis = 25.0f;
 
 
 };
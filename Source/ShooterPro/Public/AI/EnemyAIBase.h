@@ -30,12 +30,14 @@ class SHOOTERPRO_API AEnemyAIBase : public AGSCModularCharacter, public IInterfa
 
 public:
 	/** 생성자 */
-	AEnemyAIBase();
+	AEnemyAIBase(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
 protected:
 	/** 게임 시작 시 또는 스폰 후 최초 호출 */
 	virtual void BeginPlay() override;
 
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	UFUNCTION()
 	void OnAbilityEndedCallback(const UGameplayAbility* EndedAbility);
 
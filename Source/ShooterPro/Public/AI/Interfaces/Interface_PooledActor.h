@@ -0,0 +1,32 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Interface.h"
+#include "Interface_PooledActor.generated.h"
+
+// This class does not need to be modified.
+UINTERFACE(meta=(CannotImplementInterfaceInBlueprint))
+class UInterface_PooledActor : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/**
+ * UEnemyProjectilePoolSubsystem이 재사용하는 액터가 구현하는 리셋 훅
+ */
+class SHOOTERPRO_API IInterface_PooledActor
+{
+	GENERATED_BODY()
+
+public:
+	// 풀에서 꺼내져 배치된 직후 (위치, Owner, Instigator는 이미 설정된 상태)
+	virtual void OnAcquiredFromPool() {}
+
+	// 풀로 돌아갈 때 (처음 스폰되어 풀에 들어갈 때도 호출). 숨김, 충돌/이동/이펙트 정지, 상태 초기화
+	virtual void OnReleasedToPool() {}
+
+	// 꺼낸 뒤 자동으로 반납될 때까지의 시간 (0 이하면 직접 반납할 때까지 유지)
+	virtual float GetPooledLifeSpan() const { return 0.0f; }
+};
@@ -3,7 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "BehaviorTree/BTService.h"
+#include "AI/Service/BTService_LODBase.h"
 #include "BTService_CanActivateOneOfAbilities.generated.h"
 
 /**
@@ -12,7 +12,7 @@
  *   - 결과를 Boolean 형태로 블랙보드에 저장
  */
 UCLASS()
-class SHOOTERPRO_API UBTService_CanActivateOneOfAbilities : public UBTService
+class SHOOTERPRO_API UBTService_CanActivateOneOfAbilities : public UBTService_LODBase
 {
 	GENERATED_BODY()
 
@@ -1,7 +1,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "BehaviorTree/BTService.h"
+#include "AI/Service/BTService_LODBase.h"
 #include "BTService_HandlePerception.generated.h"
 
 // 전방 선언
@@ -16,7 +16,7 @@ struct FPerceivedActorInfo;
  * 예를 들어, AI가 적을 감지하거나 적의 위치를 잃었을 때 특정 행동을 취할 수 있도록 처리합니다.
  */
 UCLASS()
-class SHOOTERPRO_API UBTService_HandlePerception : public UBTService
+class SHOOTERPRO_API UBTService_HandlePerception : public UBTService_LODBase
 {
 	GENERATED_BODY()
 
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BehaviorTree/BTService.h"
+#include "BTService_LODBase.generated.h"
+
+/**
+ * @brief 거리 레이어(UAIOptimizerComponent)에 따라 Tick 간격이 늘어나는 서비스의 기반 클래스.
+ * 플레이어와 멀리 있는 AI는 Interval * 배율 간격으로만 서비스가 실행된다.
+ * 트리 자체는 유지되므로 플레이어가 다가와도 동작이 튀지 않는다.
+ */
+UCLASS(Abstract)
+class SHOOTERPRO_API UBTService_LODBase : public UBTService
+{
+	GENERATED_BODY()
+
+protected:
+	/** Interval/RandomDeviation으로 계산한 다음 Tick 시간에 LOD 배율을 곱한다 */
+	virtual void ScheduleNextTick(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) override;
+};
@@ -1,7 +1,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "BehaviorTree/BTService.h"
+#include "AI/Service/BTService_LODBase.h"
 #include "BTService_SelectAttackTarget.generated.h"
 
 class AEnemyAIController;
@@ -12,7 +12,7 @@ class UProAIBehaviorsComponent;
  * AttackableTargets에서 가장 적합한 타겟을 선정하여 AttackTarget으로 설정.
  */
 UCLASS()
-class SHOOTERPRO_API UBTService_SelectAttackTarget : public UBTService
+class SHOOTERPRO_API UBTService_SelectAttackTarget : public UBTService_LODBase
 {
 	GENERATED_BODY()
 
@@ -0,0 +1,139 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AbilitySystem/ProEffectSpecCacheSubsystem.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AoEZoneSubsystem.generated.h"
+
+class UAbilitySystemComponent;
+class UGameplayEffect;
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("AoE Zones"), STAT_ProEffects_AoEZones, STATGROUP_ProEffects, SHOOTERPRO_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("AoE Indexed Pawns"), STAT_ProEffects_AoEIndexedPawns, STATGROUP_ProEffects, SHOOTERPRO_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("AoE Applications"), STAT_ProEffects_AoEApplications, STATGROUP_ProEffects, SHOOTERPRO_API);
+
+/** 장판 하나의 설정 */
+USTRUCT(BlueprintType)
+struct SHOOTERPRO_API FProAoEZoneParams
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="AoE Zone")
+	TSubclassOf<UGameplayEffect> EffectClass;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="AoE Zone")
+	float EffectLevel = 1.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="AoE Zone", meta=(ClampMin=0))
+	float Radius = 200.0f;
+
+	/** 유지 시간 (0이면 RemoveZone까지 유지) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="AoE Zone", meta=(ClampMin=0))
+	float Duration = 0.0f;
+
+	/** 안에 있는 대상에게 이 간격마다 적용 (0이면 들어올 때 한 번만 적용) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="AoE Zone", meta=(ClampMin=0))
+	float DamageInterval = 0.0f;
+};
+
+USTRUCT(BlueprintType)
+struct SHOOTERPRO_API FProAoEZoneHandle
+{
+	GENERATED_BODY()
+
+public:
+	bool IsValid() const { return Id != INDEX_NONE; }
+	void Invalidate() { Id = INDEX_NONE; }
+
+	int32 Id = INDEX_NONE;
+};
+
+/**
+ * 오버랩 구체 액터 대신 주기적인 공간 질의로 장판(AoE) 피해를 처리하는 서브시스템
+ * - PulseRate(Hz)마다 ASC가 있는 폰만 셀 해시에 넣고, 장판마다 겹치는 셀만 검사한다 (물리 오버랩 이벤트 없음).
+ * - DamageInterval이 있으면 범위 안 대상에게 주기적으로, 없으면 새로 들어온 대상에게 한 번만 적용한다.
+ * - 적용은 UProEffectSpecCacheSubsystem 대기열로 모아서 한꺼번에 처리한다.
+ * - 보여줄 것이 없는 장판은 액터 없이 AddZone만으로 만들 수 있다.
+ */
+UCLASS(Config=Game)
+class SHOOTERPRO_API UAoEZoneSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	//~ Begin UWorldSubsystem interface
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+	//~ End UWorldSubsystem interface
+
+	//~ Begin FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override { return Zones.Num() > 0; }
+	virtual TStatId GetStatId() const override;
+	//~ End FTickableGameObject interface
+
+public:
+	/** 장판 추가. SourceASC가 없으면 대상 자신의 ASC로 Spec을 만든다 (AProjectileAOEActor 기존 동작) */
+	UFUNCTION(BlueprintCallable, Category="AoE Zone")
+	FProAoEZoneHandle AddZone(const FProAoEZoneParams& Params, FVector Center, UObject* SourceObject, UAbilitySystemComponent* SourceASC = nullptr);
+
+	UFUNCTION(BlueprintCallable, Category="AoE Zone")
+	void RemoveZone(UPARAM(ref) FProAoEZoneHandle& Handle);
+
+	UFUNCTION(BlueprintPure, Category="AoE Zone")
+	int32 GetNumZones() const { return Zones.Num(); }
+
+private:
+	struct FZone
+	{
+		FProAoEZoneParams Params;
+		FVector Center = FVector::ZeroVector;
+		double EndTime = 0.0;
+		double NextDamageTime = 0.0;
+		TWeakObjectPtr<UObject> SourceObject;
+		TWeakObjectPtr<UAbilitySystemComponent> SourceASC;
+
+		/** 진입 시 한 번 적용하는 장판에서 지난 펄스에 안에 있던 대상 */
+		TSet<TObjectKey<UAbilitySystemComponent>> InsideTargets;
+	};
+
+	void Pulse();
+	void RemoveExpiredZones(double Now);
+	void BuildPawnIndex();
+
+	/** 구 안에 있는 인덱스된 폰의 번호를 모은다 */
+	void QueryPawns(const FVector& Center, float Radius, TArray<int32>& OutPawns) const;
+
+	int64 GetCellKey(int32 CellX, int32 CellY) const
+	{
+		return (static_cast<int64>(CellX) << 32) | static_cast<uint32>(CellY);
+	}
+
+protected:
+	/** 공간 질의 빈도 (Hz) */
+	UPROPERTY(Config)
+	float PulseRate = 10.0f;
+
+	/** 폰 셀 해시의 셀 크기 */
+	UPROPERTY(Config)
+	float CellSize = 400.0f;
+
+	/** 장판 위아래로 대상을 인정하는 높이 (구 대신 납작한 원기둥으로 판정) */
+	UPROPERTY(Config)
+	float HalfHeight = 200.0f;
+
+private:
+	TMap<int32, FZone> Zones;
+	int32 NextZoneId = 0;
+
+	float PulseAccumulator = 0.0f;
+
+	// 펄스마다 다시 만드는 폰 인덱스 (SoA)
+	TArray<FVector> PawnLocations;
+	TArray<TWeakObjectPtr<UAbilitySystemComponent>> PawnASCs;
+	TArray<TPair<int64, int32>> SortedPawns;
+	TMap<int64, TPair<int32, int32>> CellRanges;
+
+	TArray<int32> QueryScratch;
+};
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "DistanceBandSubsystem.generated.h"
+
+/** 거리 밴드 경계를 넘었을 때 호출 (true: 임계값 안으로 진입, false: 밖으로 이탈) */
+DECLARE_DELEGATE_OneParam(FOnDistanceBandChanged, bool /*bInside*/);
+
+/**
+ * 여러 AI의 (Self, Target, Threshold) 거리 조건을 한 곳에서 매 프레임 일괄 평가하는 서브시스템
+ * - 제곱 거리만 사용하며(sqrt 없음), 경계를 넘는 순간에만 콜백을 호출한다.
+ * - 진입은 Threshold 이하, 이탈은 Threshold + Hysteresis 초과로 판단하여 경계 부근에서의 떨림을 막는다.
+ * - BTDecorator_CheckDistanceToTarget이 서비스 폴링 대신 이 서브시스템에 등록해 사용한다.
+ */
+UCLASS()
+class SHOOTERPRO_API UDistanceBandSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static constexpr int32 InvalidHandle = INDEX_NONE;
+
+	//~ Begin UWorldSubsystem interface
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+	//~ End UWorldSubsystem interface
+
+	//~ Begin FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override { return NumActiveBands > 0; }
+	virtual TStatId GetStatId() const override;
+	//~ End FTickableGameObject interface
+
+public:
+	/**
+	 * 거리 밴드를 등록한다.
+	 * @return 해제/갱신에 사용할 핸들. 등록 시점의 안/밖 상태는 OutbInside로 돌려준다.
+	 */
+	int32 RegisterBand(AActor* SelfActor, AActor* TargetActor, float Threshold, float Hysteresis, FOnDistanceBandChanged&& Callback, bool& OutbInside);
+
+	/** 등록 해제 후 Handle을 InvalidHandle로 되돌린다 */
+	void UnregisterBand(int32& Handle);
+
+	/** 타겟 또는 임계값이 바뀌었을 때 갱신. 현재 상태는 다시 계산하여 반환한다 */
+	bool UpdateBand(int32 Handle, AActor* TargetActor, float Threshold);
+
+	int32 GetNumActiveBands() const { return NumActiveBands; }
+
+	/**
+	 * 히스테리시스를 고려한 안/밖 판정. 데코레이터의 조건 평가와 서브시스템이 같은 규칙을 쓰도록 공개한다.
+	 */
+	static bool EvaluateBand(float DistSquared, float Threshold, float Hysteresis, bool bWasInside)
+	{
+		const float Limit = bWasInside ? Threshold + Hysteresis : Threshold;
+		return DistSquared <= FMath::Square(FMath::Max(Limit, 0.0f));
+	}
+
+private:
+	bool IsValidBand(int32 Handle) const { return BandActive.IsValidIndex(Handle) && BandActive[Handle]; }
+
+	bool ComputeInside(int32 Handle, bool bWasInside) const;
+
+private:
+	// SoA 레이아웃: 한 번의 루프에서 필요한 값만 연속으로 읽도록 분리해 둔다
+	TArray<TWeakObjectPtr<AActor>> SelfActors;
+	TArray<TWeakObjectPtr<AActor>> TargetActors;
+	TArray<float> Thresholds;
+	TArray<float> Hysteresises;
+	TArray<bool> BandInside;
+	TArray<bool> BandActive;
+	TArray<FOnDistanceBandChanged> Callbacks;
+
+	/** 재사용 가능한 슬롯 */
+	TArray<int32> FreeSlots;
+
+	int32 NumActiveBands = 0;
+
+	/** Tick 중 경계를 넘은 밴드 (콜백은 루프가 끝난 뒤 호출) */
+	TArray<TPair<int32, bool>> PendingCrossings;
+};
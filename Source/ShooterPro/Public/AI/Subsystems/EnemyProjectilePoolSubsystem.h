@@ -0,0 +1,85 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "EnemyProjectilePoolSubsystem.generated.h"
+
+/** 클래스 하나에 대한 대기 중인 액터 목록 */
+USTRUCT()
+struct FEnemyPooledActorList
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY()
+	TArray<TObjectPtr<AActor>> FreeActors;
+};
+
+/**
+ * 적 투사체(AEnemyProjectile)와 장판(AProjectileAOEActor)을 월드 단위로 재사용하는 풀
+ * - 클래스별 대기 목록에서 O(1)로 꺼내고, 반납 시 IInterface_PooledActor 훅으로 상태를 초기화한다.
+ * - 수명은 InitialLifeSpan 대신 풀이 관리한다 (GetPooledLifeSpan이 지나면 자동 반납).
+ * - 스피터가 몰려오는 웨이브에서 매 투척마다 생기던 SpawnActor/Destroy 히치를 없앤다.
+ */
+UCLASS()
+class SHOOTERPRO_API UEnemyProjectilePoolSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	//~ Begin UWorldSubsystem interface
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+	//~ End UWorldSubsystem interface
+
+	//~ Begin FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override { return ActiveActors.Num() > 0; }
+	virtual TStatId GetStatId() const override;
+	//~ End FTickableGameObject interface
+
+public:
+	/** 풀에서 액터를 꺼내 배치한다 (대기 중인 액터가 없으면 스폰) */
+	UFUNCTION(BlueprintCallable, Category="Enemy Projectile Pool", meta=(DeterminesOutputType="ActorClass"))
+	AActor* AcquireActor(TSubclassOf<AActor> ActorClass, const FTransform& Transform, AActor* NewOwner, APawn* NewInstigator);
+
+	template <typename T>
+	T* Acquire(TSubclassOf<T> ActorClass, const FTransform& Transform, AActor* NewOwner, APawn* NewInstigator)
+	{
+		return Cast<T>(AcquireActor(ActorClass, Transform, NewOwner, NewInstigator));
+	}
+
+	/** 사용 중인 액터를 풀로 되돌린다. 이 풀에서 꺼낸 액터가 아니면 false */
+	UFUNCTION(BlueprintCallable, Category="Enemy Projectile Pool")
+	bool ReleaseActor(AActor* Actor);
+
+	/** 대기 중인 액터가 Count개가 되도록 미리 스폰해 둔다 */
+	UFUNCTION(BlueprintCallable, Category="Enemy Projectile Pool")
+	void Prewarm(TSubclassOf<AActor> ActorClass, int32 Count);
+
+	/** 풀에서 꺼낸 액터면 반납하고, 아니면 파괴한다 (기존 Destroy() 호출 자리에서 사용). 이미 반납된 액터면 아무것도 안 함 */
+	static void ReleaseOrDestroy(AActor* Actor);
+
+	/** 풀에 대기 중이 아니고 파괴되지도 않은 액터면 true (반납 후 같은 프레임에 들어온 충돌 이벤트 무시용) */
+	static bool IsActorInUse(const AActor* Actor);
+
+	/** 이 풀의 대기 목록에 있는 액터인지 */
+	bool IsActorFree(const AActor* Actor) const;
+
+	int32 GetNumActive() const { return ActiveActors.Num(); }
+
+private:
+	AActor* SpawnPooledActor(TSubclassOf<AActor> ActorClass);
+
+private:
+	UPROPERTY()
+	TMap<TSubclassOf<AActor>, FEnemyPooledActorList> Pools;
+
+	/** 사용 중인 액터와 자동 반납 시각 (0 이하면 무제한). 사용 중인 액터는 레벨이 참조하므로 약한 키로 충분하다 */
+	TMap<TObjectKey<AActor>, double> ActiveActors;
+
+	/** 이 풀이 스폰한 액터 (풀 밖에서 스폰된 액터와 구분해 대기 여부를 해시로 판정) */
+	TSet<TObjectKey<AActor>> PooledActors;
+
+	TArray<TObjectKey<AActor>> ExpiredActors;
+};
@@ -0,0 +1,168 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tasks/Task.h"
+#include "TacticalInfluenceSubsystem.generated.h"
+
+/** 영향력 맵의 레이어 */
+UENUM(BlueprintType)
+enum class ETacticalInfluenceLayer : uint8
+{
+	Threat, // 플레이어의 사선(조준 방향) 위험도
+	PlayerPresence, // 플레이어 주변 존재감
+	Noise, // 최근 발생한 소음
+	ZombieDensity, // 좀비 밀집도
+	Num UMETA(Hidden)
+};
+
+/** 레이어별 가중치. 각 레이어 값에 곱한 뒤 더해서 위치 점수를 계산한다 */
+USTRUCT(BlueprintType)
+struct SHOOTERPRO_API FTacticalInfluenceWeights
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Tactical Influence")
+	float Threat = 0.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Tactical Influence")
+	float PlayerPresence = 0.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Tactical Influence")
+	float Noise = 0.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Tactical Influence")
+	float ZombieDensity = 0.0f;
+};
+
+/**
+ * 플레이어 주변을 덮는 저해상도 2D 전술 영향력 맵
+ * - 위협(사선), 플레이어 존재감, 최근 소음, 좀비 밀집도 4개 레이어를 가진다.
+ * - 게임 스레드는 매 Tick 입력 스냅샷만 만들고, 셀 계산은 워커 스레드에서 ParallelFor로 RowsPerSlice 줄씩 나눠 수행한다.
+ * - 한 바퀴(전체 줄) 계산이 끝나면 앞/뒤 버퍼를 교체하므로, 조회는 항상 완성된 앞 버퍼를 O(1)로 읽는다.
+ * - 비용은 AI 수와 무관하게 한 번만 지불되고 모든 AI가 결과를 공유한다.
+ */
+UCLASS(Config=Game)
+class SHOOTERPRO_API UTacticalInfluenceSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	//~ Begin UWorldSubsystem interface
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	//~ End UWorldSubsystem interface
+
+	//~ Begin FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	//~ End FTickableGameObject interface
+
+	//=============================================================================
+	// 입력 등록
+	//=============================================================================
+public:
+	/** 좀비(AI) 등록 - 밀집도 레이어에 반영 */
+	void RegisterAgent(AActor* Agent);
+	void UnregisterAgent(AActor* Agent);
+
+	/** 소음 보고. Loudness는 1이 기준이며 NoiseLifetime 동안 선형으로 사라진다 */
+	UFUNCTION(BlueprintCallable, Category="Tactical Influence")
+	void ReportNoise(const FVector& Location, float Loudness = 1.0f);
+
+	//=============================================================================
+	// 조회 (게임 스레드, O(1))
+	//=============================================================================
+public:
+	/** 위치의 레이어 값. 맵 범위 밖이면 0 */
+	UFUNCTION(BlueprintPure, Category="Tactical Influence")
+	float GetInfluence(const FVector& Location, ETacticalInfluenceLayer Layer) const;
+
+	/** 위치의 가중 합 점수 */
+	UFUNCTION(BlueprintPure, Category="Tactical Influence")
+	float ScoreLocation(const FVector& Location, const FTacticalInfluenceWeights& Weights) const;
+
+	/** 위치가 현재 맵 범위 안에 있는지 */
+	UFUNCTION(BlueprintPure, Category="Tactical Influence")
+	bool IsInsideMap(const FVector& Location) const;
+
+	/** 한 번이라도 전체 계산이 끝나 조회 가능한 상태인지 */
+	UFUNCTION(BlueprintPure, Category="Tactical Influence")
+	bool HasValidMap() const { return bHasValidFront; }
+
+private:
+	/** 한 버퍼 분량의 레이어 데이터 */
+	struct FInfluenceGrid
+	{
+		FVector2D Origin = FVector2D::ZeroVector;
+		TArray<float> Layers[static_cast<int32>(ETacticalInfluenceLayer::Num)];
+	};
+
+	/** 워커 스레드가 읽는 입력 스냅샷 (한 바퀴 동안 고정) */
+	struct FInfluenceSnapshot
+	{
+		FVector2D Origin = FVector2D::ZeroVector;
+		TArray<FVector2D> PlayerLocations;
+		TArray<FVector2D> PlayerForwards;
+		TArray<FVector2D> NoiseLocations;
+		TArray<float> NoiseStrengths;
+		TArray<uint16> AgentCounts;
+	};
+
+	struct FNoiseEvent
+	{
+		FVector2D Location;
+		float Loudness;
+		double Time;
+	};
+
+	void BuildSnapshot();
+	void LaunchSlice();
+	void ComputeRow(int32 Row);
+
+	bool WorldToCell(const FInfluenceGrid& Grid, const FVector& Location, int32& OutIndex) const;
+
+protected:
+	/** 셀 한 변의 길이 (cm) */
+	UPROPERTY(Config)
+	float CellSize = 200.0f;
+
+	/** 한 변의 셀 수 (GridSize x GridSize) */
+	UPROPERTY(Config)
+	int32 GridSize = 128;
+
+	/** 한 Tick에 계산하는 줄 수 */
+	UPROPERTY(Config)
+	int32 RowsPerSlice = 16;
+
+	/** 플레이어 존재감이 퍼지는 반경 (가우시안 시그마) */
+	UPROPERTY(Config)
+	float PresenceRadius = 800.0f;
+
+	/** 플레이어 사선 위협이 미치는 거리 */
+	UPROPERTY(Config)
+	float ThreatRange = 3000.0f;
+
+	/** 소음이 퍼지는 반경 */
+	UPROPERTY(Config)
+	float NoiseRadius = 1000.0f;
+
+	/** 소음이 완전히 사라지기까지의 시간 (초) */
+	UPROPERTY(Config)
+	float NoiseLifetime = 10.0f;
+
+private:
+	FInfluenceGrid Grids[2];
+	int32 FrontIndex = 0;
+	bool bHasValidFront = false;
+
+	FInfluenceSnapshot Snapshot;
+	int32 NextRow = 0;
+
+	UE::Tasks::FTask PendingSlice;
+
+	TArray<TWeakObjectPtr<AActor>> Agents;
+	TArray<FNoiseEvent> NoiseEvents;
+};
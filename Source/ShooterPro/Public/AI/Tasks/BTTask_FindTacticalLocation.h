@@ -0,0 +1,51 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AI/Subsystems/TacticalInfluenceSubsystem.h"
+#include "BehaviorTree/BTTaskNode.h"
+#include "BTTask_FindTacticalLocation.generated.h"
+
+/**
+ * 전술 영향력 맵(UTacticalInfluenceSubsystem)을 이용해 이동할 위치를 고르는 BTTask입니다.
+ * 기준 액터 주변 원 위의 후보 지점들을 가중치로 점수화하여 가장 높은 지점을 블랙보드에 저장합니다.
+ * - 측면 공격: Threat 음수 가중치 (플레이어 사선을 피해서 접근)
+ * - 흩어지기: ZombieDensity 음수 가중치
+ * - 수색: Noise 양수 가중치 (최근 소음이 난 곳을 우선 수색)
+ * 후보 하나당 조회 비용은 O(1)이므로 매우 가볍습니다.
+ */
+UCLASS()
+class SHOOTERPRO_API UBTTask_FindTacticalLocation : public UBTTaskNode
+{
+	GENERATED_BODY()
+
+public:
+	UBTTask_FindTacticalLocation();
+
+protected:
+	virtual EBTNodeResult::Type ExecuteTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) override;
+
+protected:
+	// 후보 지점의 중심이 될 액터 키 (비어 있으면 자기 자신)
+	UPROPERTY(EditAnywhere, Category="Tactical")
+	FBlackboardKeySelector OriginActorKey;
+
+	// 찾은 위치를 저장할 블랙보드 키
+	UPROPERTY(EditAnywhere, Category="Tactical")
+	FBlackboardKeySelector ResultLocationKey;
+
+	// 후보 지점을 뿌릴 반경
+	UPROPERTY(EditAnywhere, Category="Tactical", meta=(ClampMin="0.0"))
+	float SampleRadius = 600.0f;
+
+	// 후보 지점 수
+	UPROPERTY(EditAnywhere, Category="Tactical", meta=(ClampMin="1", ClampMax="64"))
+	int32 NumSamples = 12;
+
+	// 레이어별 가중치
+	UPROPERTY(EditAnywhere, Category="Tactical")
+	FTacticalInfluenceWeights Weights;
+
+	// 자신과의 거리 1m당 감점 (너무 먼 후보를 피하기 위함)
+	UPROPERTY(EditAnywhere, Category="Tactical", meta=(ClampMin="0.0"))
+	float DistancePenaltyPerMeter = 0.01f;
+};
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+
+/** 발사 속도 계산 요청 한 건 */
+struct FBallisticSolveRequest
+{
+	FVector Start = FVector::ZeroVector;
+	FVector TargetLocation = FVector::ZeroVector;
+
+	/** 0이 아니면 비행 시간 동안 이동할 위치를 예측해서 조준 */
+	FVector TargetVelocity = FVector::ZeroVector;
+
+	float Speed = 0.0f;
+
+	/** 월드 중력 * 투사체 중력 배율 (보통 음수) */
+	float GravityZ = 0.0f;
+
+	bool bHighArc = false;
+};
+
+/** 계산 결과 */
+struct FBallisticSolution
+{
+	FVector Velocity = FVector::ZeroVector;
+	float FlightTime = 0.0f;
+	bool bValid = false;
+};
+
+/**
+ * FBallisticSolver
+ *
+ * 고정 속력 투사체의 발사 속도를 닫힌 형태(해석해)로 계산합니다.
+ * - 낮은/높은 포물선: tanθ = (v² ∓ √(v⁴ - g(gx² + 2yv²))) / (gx)
+ * - 움직이는 대상: 비행 시간 → 예측 위치 → 다시 포물선을 몇 번 반복해 수렴시킵니다.
+ * - SolveBatch는 같은 프레임에 발사하는 여러 요청을 한 번에 처리합니다 (많으면 병렬).
+ *
+ * UGameplayStatics::SuggestProjectileVelocity와 달리 트레이스나 UObject 접근이 없어 워커 스레드에서도 호출할 수 있습니다.
+ */
+struct SHOOTERPRO_API FBallisticSolver
+{
+public:
+	/**
+	 * 정지한 목표를 맞히는 두 해(낮은/높은 포물선)를 구한다.
+	 * @return 해의 수 (0: 사거리 밖, 1: 두 해가 같거나 중력 없음, 2)
+	 */
+	static int32 SolveArcs(const FVector& Start, const FVector& Target, float Speed, float GravityZ,
+	                       FVector& OutLowVelocity, FVector& OutHighVelocity, float* OutLowTime = nullptr, float* OutHighTime = nullptr);
+
+	/** 움직이는 대상을 선행 조준하는 발사 속도 */
+	static FBallisticSolution Solve(const FBallisticSolveRequest& Request);
+
+	/** 여러 요청을 한 번에 계산. OutSolutions는 Requests와 같은 크기여야 한다 */
+	static void SolveBatch(TConstArrayView<FBallisticSolveRequest> Requests, TArrayView<FBallisticSolution> OutSolutions);
+
+	/** 선행 조준 반복 횟수 상한 */
+	static constexpr int32 MaxInterceptIterations = 6;
+
+	/** 이 개수 이상이면 SolveBatch를 병렬로 처리 */
+	static constexpr int32 ParallelBatchThreshold = 32;
+};
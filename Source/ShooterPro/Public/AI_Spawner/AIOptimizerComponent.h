@@ -32,6 +32,20 @@ public:
 	UFUNCTION(BlueprintCallable)
 	void OptimizerSetting(UPARAM(meta = (Bitmask, BitmaskEnum = "/Script/ShooterPro.EAIOptimizerFlags"))int32 OptimizerEnable);
 	//ACharacter* Character, AAIController* AIC, 
+
+	// Current distance layer (2: short, 1: middle, 0: long, -1: out of range)
+	//  Ÿ ̾ (2: ٰŸ, 1: ߰Ÿ, 0: Ÿ, -1:  )
+	UFUNCTION(BlueprintPure)
+	int32 GetCurrentLayer() const { return CurrentLayer; }
+
+	// Multiplier applied to behavior tree service intervals for the current layer
+	//  ̾ ̺ Ʈ  Interval  
+	UFUNCTION(BlueprintPure)
+	float GetServiceIntervalScale() const;
+
+	// Service interval multiplier of the AI controlled by AIC. 1 if it has no optimizer
+	// AIC ϴ AI  Interval . ȭ Ʈ  1
+	static float GetServiceIntervalScale(const AAIController* AIC);
 protected:
 	// A short range layer that recognizes players. Not disabled.
 	// ÷̾ νϴ ª  ̾.  Ȱȭ .
@@ -46,6 +60,19 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Layer Radius")
 	float LayerLong;
 
+	// Behavior tree LOD. Long range pauses the tree instead of stopping it, so its state survives.
+	// ̺ Ʈ LOD. Ÿ Ʈ (Stop) ʰ Ͻ(Pause)Ͽ ¸ .
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Behavior LOD")
+	bool bUseBehaviorTreeLOD;
+	// Service interval multiplier on the short range layer
+	// ٰŸ ̾  Interval 
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Behavior LOD", meta = (ClampMin = "1.0", EditCondition = "bUseBehaviorTreeLOD"))
+	float ShortLayerServiceIntervalScale;
+	// Service interval multiplier on the middle range layer
+	// ߰Ÿ ̾  Interval 
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Behavior LOD", meta = (ClampMin = "1.0", EditCondition = "bUseBehaviorTreeLOD"))
+	float MiddleLayerServiceIntervalScale;
+
 protected:
 	// Stop the behavior tree
 	// ̺ Ʈ 
@@ -62,4 +89,6 @@ protected:
 	int32 DistanceLayer();
 
 	FTimerHandle LayerCheckLoopTimer;
+
+	int32 CurrentLayer;
 };
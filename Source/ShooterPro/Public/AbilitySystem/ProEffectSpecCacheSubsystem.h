@@ -0,0 +1,138 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayEffectTypes.h"
+#include "Engine/HitResult.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "ProEffectSpecCacheSubsystem.generated.h"
+
+class UAbilitySystemComponent;
+class UGameplayEffect;
+
+DECLARE_STATS_GROUP(TEXT("ShooterPro Effects"), STATGROUP_ProEffects, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Cached Specs"), STAT_ProEffects_CachedSpecs, STATGROUP_ProEffects, SHOOTERPRO_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Spec Cache Hits"), STAT_ProEffects_SpecCacheHits, STATGROUP_ProEffects, SHOOTERPRO_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Spec Cache Misses"), STAT_ProEffects_SpecCacheMisses, STATGROUP_ProEffects, SHOOTERPRO_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Batched Applications"), STAT_ProEffects_BatchedApplications, STATGROUP_ProEffects, SHOOTERPRO_API);
+
+/** 이펙트 적용 요청 한 건 (Spec을 만드는 ASC, 대상 ASC, 이펙트 클래스/레벨/소스 오브젝트, 선택적 HitResult/맞힌 오브젝트) */
+struct SHOOTERPRO_API FProEffectApplication
+{
+	TWeakObjectPtr<UAbilitySystemComponent> SourceASC;
+	TWeakObjectPtr<UAbilitySystemComponent> TargetASC;
+	TSubclassOf<UGameplayEffect> EffectClass;
+	float Level = 1.0f;
+	TWeakObjectPtr<UObject> SourceObject;
+
+	FHitResult HitResult;
+	bool bHasHitResult = false;
+
+	/** 적용마다 바뀌는 소스 오브젝트 (풀링된 탄환 등). 캐시 키에 넣지 않고 HitResult처럼 적용할 때 Context에 덮어쓴다 */
+	TWeakObjectPtr<UObject> HitSourceObject;
+
+	void SetHitResult(const FHitResult& InHitResult)
+	{
+		HitResult = InHitResult;
+		bHasHitResult = true;
+	}
+
+	bool HasHitSourceObject() const { return !HitSourceObject.IsExplicitlyNull(); }
+};
+
+/** 캐시 키: (이펙트 클래스, 레벨, 소스 ASC, 소스 오브젝트, HitResult/맞힌 오브젝트 사용 여부) */
+struct FProEffectSpecCacheKey
+{
+	TObjectKey<UClass> EffectClass;
+	TObjectKey<UAbilitySystemComponent> SourceASC;
+	TObjectKey<UObject> SourceObject;
+	float Level = 1.0f;
+	bool bWithHitResult = false;
+	bool bWithHitSourceObject = false;
+
+	bool operator==(const FProEffectSpecCacheKey& Other) const
+	{
+		return EffectClass == Other.EffectClass && SourceASC == Other.SourceASC && SourceObject == Other.SourceObject
+			&& Level == Other.Level && bWithHitResult == Other.bWithHitResult && bWithHitSourceObject == Other.bWithHitSourceObject;
+	}
+
+	friend uint32 GetTypeHash(const FProEffectSpecCacheKey& Key)
+	{
+		uint32 Hash = HashCombineFast(GetTypeHash(Key.EffectClass), GetTypeHash(Key.SourceASC));
+		Hash = HashCombineFast(Hash, GetTypeHash(Key.SourceObject));
+		Hash = HashCombineFast(Hash, GetTypeHash(Key.Level));
+		Hash = HashCombineFast(Hash, GetTypeHash(Key.bWithHitResult));
+		return HashCombineFast(Hash, GetTypeHash(Key.bWithHitSourceObject));
+	}
+};
+
+/**
+ * 투사체/함정 피해용 GameplayEffectSpec 캐시 서브시스템
+ * - 맞을 때마다 MakeEffectContext + MakeOutgoingSpec으로 새 Spec/Context를 할당하던 것을 키별로 한 번만 만들어 재사용한다.
+ * - HitResult/맞힌 오브젝트(HitSourceObject)가 필요한 적용은 캐시된 Context의 해당 값만 바꿔서 적용한다.
+ *   탄환처럼 발마다 다른 오브젝트는 SourceObject 대신 HitSourceObject로 넘겨야 발사자 기준으로 Spec이 재사용된다.
+ *   지속 이펙트는 활성 이펙트가 Context를 계속 들고 있으므로 Context를 복제한 Spec으로 적용한다.
+ * - Apply는 기본적으로 즉시 적용하고 Spec 조회만 캐시를 거친다 (명중 프레임에 피해/큐가 발생).
+ * - Enqueue로 들어온 적용은 다음 Tick에 키 순으로 묶어서 한꺼번에 처리한다. 한 프레임 늦게 적용되므로
+ *   같은 프레임 다수 대상 피해처럼 지연이 드러나지 않는 경우에만 사용한다.
+ * - 소스 어트리뷰트 스냅샷이 오래되지 않도록 MaxSpecAge가 지난 Spec은 버리고 다시 만든다.
+ * - "stat ProEffects"로 캐시 적중/실패, 묶음 적용 수를 확인할 수 있다.
+ */
+UCLASS(Config=Game)
+class SHOOTERPRO_API UProEffectSpecCacheSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	//~ Begin UWorldSubsystem interface
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+	//~ End UWorldSubsystem interface
+
+	//~ Begin FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override { return PendingApplications.Num() > 0 || CachedSpecs.Num() > 0; }
+	virtual TStatId GetStatId() const override;
+	//~ End FTickableGameObject interface
+
+public:
+	/** 캐시된 Spec으로 즉시 적용 */
+	void ApplyNow(const FProEffectApplication& Application);
+
+	/** 묶음 적용 대기열에 추가 (다음 Tick에 적용되므로 한 프레임 지연) */
+	void Enqueue(FProEffectApplication&& Application);
+
+	/**
+	 * 서브시스템이 있으면 캐시된 Spec으로 즉시 적용(bBatched면 대기열에 넣어 다음 Tick에 적용),
+	 * 없으면(에디터 월드 등) 기존처럼 새 Spec을 만들어 즉시 적용
+	 */
+	static void Apply(const UObject* WorldContextObject, FProEffectApplication&& Application, bool bBatched = false);
+
+	int32 GetNumCachedSpecs() const { return CachedSpecs.Num(); }
+
+private:
+	struct FCachedSpec
+	{
+		FGameplayEffectSpecHandle SpecHandle;
+		double CreationTime = 0.0;
+	};
+
+	static FProEffectSpecCacheKey MakeKey(const FProEffectApplication& Application);
+
+	FGameplayEffectSpecHandle FindOrMakeSpec(const FProEffectSpecCacheKey& Key, const FProEffectApplication& Application);
+
+	static void ApplySpec(const FGameplayEffectSpecHandle& SpecHandle, const FProEffectApplication& Application);
+
+	void FlushPendingApplications();
+	void EvictExpiredSpecs();
+
+protected:
+	/** 캐시된 Spec을 다시 만들기까지의 시간 (초). 소스 어트리뷰트 스냅샷 갱신 주기 */
+	UPROPERTY(Config)
+	float MaxSpecAge = 0.5f;
+
+private:
+	TMap<FProEffectSpecCacheKey, FCachedSpec> CachedSpecs;
+
+	TArray<FProEffectApplication> PendingApplications;
+};
@@ -16,4 +16,10 @@ public:
 	bool GrantToAbilitySystemWithSource(UAbilitySystemComponent* InASC, UObject* SourceObject, FGSCAbilitySetHandle& OutAbilitySetHandle, FText* OutErrorText = nullptr, const bool bShouldRegisterCoreDelegates = true) const;
 	static bool TryGrantAbilitySetWithSource(UAbilitySystemComponent* InASC, const UGSCAbilitySet* InAbilitySet, UObject* SourceObject, FGSCAbilitySetHandle& OutAbilitySetHandle, TArray<TSharedPtr<FComponentRequestHandle>>* OutComponentRequests = nullptr);
 	static void TryGrantAbility(UAbilitySystemComponent* InASC, const FGSCGameFeatureAbilityMapping& InAbilityMapping, FGameplayAbilitySpecHandle& OutAbilityHandle, FGameplayAbilitySpec& OutAbilitySpec, UObject* SourceObject);
+
+	// 부여할 때 로드되는 소프트 참조 (어빌리티, 입력, 어트리뷰트, 이펙트)
+	void GatherSoftReferences(TArray<FSoftObjectPath>& OutPaths) const;
+
+	// 소프트 참조가 모두 메모리에 있으면 true (부여해도 동기 로드가 일어나지 않음)
+	bool AreSoftReferencesLoaded() const;
 };
@@ -20,4 +20,8 @@ public:
 	float GetGroundDistance();
 
 	float GroundTraceDistance = 100000.f;
+
+protected:
+	/** 캡슐 겹침 해소 횟수를 집계 (stat ProCrowd) */
+	virtual bool ResolvePenetrationImpl(const FVector& Adjustment, const FHitResult& Hit, const FQuat& NewRotation) override;
 };
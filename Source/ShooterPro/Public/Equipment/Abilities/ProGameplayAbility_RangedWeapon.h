@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Equipment/Abilities/ProGameplayAbility_EquipmentBase.h"
+#include "Equipment/Weapon/RangedWeaponInstance.h"
 #include "ProGameplayAbility_RangedWeapon.generated.h"
 
 class AProBulletBase;
@@ -26,9 +27,54 @@ public:
 	UFUNCTION(BlueprintCallable)
 	FVector GetHitResultWithRayCast(APlayerController* PlayerController);
 
+	// 무기의 탄 퍼짐 스트림으로 원뿔 안의 방향 하나 (무기가 없으면 임시 스트림)
 	UFUNCTION(BlueprintCallable)
-	FVector RandConeNormalDistribution(const FVector& Dir, const float ConeHalfDegree, const float Exponent);
+	FVector RandConeNormalDistribution(const FVector& Dir, const float ConeHalfAngleRad, const float Exponent);
 	
 	UFUNCTION(BlueprintCallable, Category="RangedWeapon")
 	URangedWeaponInstance* GetSourceRangedWeaponInstance() const;
+
+	/**
+	 * 무기의 연사 스케줄러로 자동 사격 시작 (FireRate 기준, 프레임 레이트와 무관)
+	 * 발마다 비용을 커밋하고, 총구 위치/방향은 지난 프레임과 이번 프레임 사이에서 발사 시각에 맞춰 보간한다.
+	 * 비용이 부족하면 스스로 멈추고 K2_OnScheduledFireStopped를 호출한다.
+	 * @param MuzzleSocketName 무기 액터 메시의 총구 소켓 (None이면 "Muzzle")
+	 */
+	UFUNCTION(BlueprintCallable, Category="RangedWeapon")
+	void StartScheduledFire(TSubclassOf<AProBulletBase> BulletClass, FName MuzzleSocketName = NAME_None);
+
+	UFUNCTION(BlueprintCallable, Category="RangedWeapon")
+	void StopScheduledFire();
+
+	virtual void EndAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, bool bReplicateEndAbility, bool bWasCancelled) override;
+
+protected:
+	// 히트스캔 펠릿 모드: 모든 펠릿을 한 번에 트레이스하고 대상별로 합쳐서 데미지 적용
+	void FireHitscanPellets(URangedWeaponInstance* WeaponInstance, const FVector& StartLocation, const FVector& Direction, TSubclassOf<AProBulletBase> BulletClass);
+
+	// 펠릿 처리 후 명중 결과 (임팩트 이펙트 등은 블루프린트에서)
+	UFUNCTION(BlueprintImplementableEvent, Category="RangedWeapon", meta=(DisplayName="On Pellets Resolved"))
+	void K2_OnPelletsResolved(const TArray<FHitResult>& Hits);
+
+	// 연사 스케줄러가 이번 프레임에 낸 발 수 (총구 이펙트/반동 등은 블루프린트에서)
+	UFUNCTION(BlueprintImplementableEvent, Category="RangedWeapon", meta=(DisplayName="On Scheduled Shots Fired"))
+	void K2_OnScheduledShotsFired(int32 NumShots);
+
+	// 비용 부족 등으로 연사가 멈춤
+	UFUNCTION(BlueprintImplementableEvent, Category="RangedWeapon", meta=(DisplayName="On Scheduled Fire Stopped"))
+	void K2_OnScheduledFireStopped(bool bOutOfCost);
+
+private:
+	void HandleScheduledShots(TConstArrayView<FProScheduledShot> Shots);
+
+	/** 현재 총구 위치와 조준 방향 (무기 액터 소켓 -> 없으면 아바타 시점) */
+	void SampleMuzzle(const URangedWeaponInstance* WeaponInstance, FVector& OutStart, FVector& OutDirection) const;
+
+	UPROPERTY()
+	TSubclassOf<AProBulletBase> ScheduledBulletClass;
+
+	FName ScheduledMuzzleSocketName;
+	FVector LastMuzzleStart = FVector::ZeroVector;
+	FVector LastMuzzleDirection = FVector::ForwardVector;
+	bool bHasLastMuzzle = false;
 };
@@ -9,6 +9,11 @@
 
 
 class UGSCAbilitySystemComponent;
+struct FStreamableHandle;
+
+DECLARE_STATS_GROUP(TEXT("ShooterPro Equipment"), STATGROUP_ProEquipment, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Deferred Ability Grants"), STAT_ProEquipment_DeferredGrants, STATGROUP_ProEquipment, SHOOTERPRO_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Pending Equipment Loads"), STAT_ProEquipment_PendingLoads, STATGROUP_ProEquipment, SHOOTERPRO_API);
 
 USTRUCT(BlueprintType)
 struct FEquipmentItem
@@ -31,6 +36,9 @@ public:
 		
 	UPROPERTY()
 	FGSCAbilitySetHandle GrantedHandles;
+
+	// 어빌리티 세트 에셋이 아직 로드 중이라 부여를 미룬 상태
+	bool bGrantPending = false;
 };
 
 
@@ -53,6 +61,9 @@ struct FEquipmentList
 
 	void RemoveItem(UEquipmentInstance* Instance);
 
+	// 장비 정의의 어빌리티 세트를 부여 (에셋이 모두 로드된 상태여야 함)
+	void GrantAbilitySets(FEquipmentItem& Entry);
+
 private:
 	friend class UEquipmentManagerComponent;
 
@@ -63,6 +74,20 @@ private:
 	TObjectPtr<UActorComponent> OwnerComponent;
 };
 
+// 캐시에 넣기 전 액터 상태 (꺼낼 때 그대로 되돌린다)
+USTRUCT()
+struct FCachedEquipmentActor
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TObjectPtr<AActor> Actor = nullptr;
+
+	bool bWasHidden = false;
+	bool bWasCollisionEnabled = true;
+	bool bWasTickEnabled = true;
+};
+
 UCLASS(BlueprintType, Const, meta = (BlueprintSpawnableComponent))
 class SHOOTERPRO_API UEquipmentManagerComponent : public UPawnComponent
 {
@@ -91,8 +116,54 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Equipment")
 	UEquipmentInstance* GetEquipmentInstanceByDefinition(TSubclassOf<UEquipmentDefinition> InDefinition) const;
 
+	// 장비 액터 캐시 (퀵바 교체마다 스폰/파괴하지 않도록)
+	// 해제된 장비 액터는 숨긴 채 떼어 두었다가 같은 클래스를 다시 장착하면 재사용하고,
+	// MaxCachedActors를 넘으면 가장 오래 쓰지 않은 액터부터 파괴한다.
+
+	// 같은 클래스의 캐시된 액터를 꺼내 넣기 전의 숨김/충돌/틱 상태로 되돌린다. 없으면 nullptr
+	AActor* AcquireCachedActor(TSubclassOf<AActor> ActorClass);
+
+	// 액터를 숨기고 떼어서 캐시에 넣는다. 넣지 못하면 false (호출한 쪽에서 파괴)
+	bool ReleaseActorToCache(AActor* Actor);
+
+	UFUNCTION(BlueprintPure, Category="Equipment")
+	int32 GetNumCachedActors() const { return CachedActors.Num(); }
+
+	// 장비의 어빌리티 세트가 참조하는 에셋(어빌리티/이펙트/어트리뷰트/입력)을 미리 비동기로 스트리밍 (인벤토리 획득 시)
+	// 장착할 때 이미 로드되어 있으면 즉시 부여하고, 아니면 로드가 끝난 프레임에 부여한다.
+	void PreloadEquipment(TSubclassOf<UEquipmentDefinition> EquipmentDefinition);
+
+	static bool AreEquipmentAssetsLoaded(const UEquipmentDefinition* EquipmentCDO);
+
+protected:
+	// 숨겨서 보관할 장비 액터 최대 수 (0이면 캐시 안 함)
+	UPROPERTY(EditDefaultsOnly, Category="Equipment", meta=(ClampMin=0))
+	int32 MaxCachedActors = 4;
 
 private:
+	friend FEquipmentList;
+
+	void DestroyCachedActors();
+
+	static void GatherEquipmentAssets(const UEquipmentDefinition* EquipmentCDO, TArray<FSoftObjectPath>& OutPaths);
+
+	// 로드가 끝나면 Instance의 어빌리티 세트를 부여
+	void RequestDeferredGrant(TSubclassOf<UEquipmentDefinition> EquipmentDefinition, UEquipmentInstance* Instance);
+
+	void OnPreloadCompleted();
+	void OnDeferredGrantLoaded(TWeakObjectPtr<UEquipmentInstance> Instance);
+
+	void CancelPendingLoads();
+
+	// 장비 정의별 미리 받기 핸들 (핸들이 살아 있는 동안 에셋이 메모리에 유지됨)
+	TMap<TSubclassOf<UEquipmentDefinition>, TSharedPtr<FStreamableHandle>> PreloadHandles;
+
+	TArray<TSharedPtr<FStreamableHandle>> DeferredGrantHandles;
+
 	UPROPERTY()
 	FEquipmentList EquipmentList;
+
+	// 캐시된 장비 액터 (오래된 순)
+	UPROPERTY(Transient)
+	TArray<FCachedEquipmentActor> CachedActors;
 };
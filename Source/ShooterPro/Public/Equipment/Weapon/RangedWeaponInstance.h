@@ -4,10 +4,28 @@
 
 #include "CoreMinimal.h"
 #include "Curves/CurveFloat.h"
+#include "Equipment/Weapon/WeaponCurveLUT.h"
 #include "Equipment/Weapon/WeaponInstance.h"
 #include "GameplayTags.h"
+#include "WorldCollision.h"
 #include "RangedWeaponInstance.generated.h"
 
+class AProBulletBase;
+
+DECLARE_STATS_GROUP(TEXT("ShooterPro Weapon"), STATGROUP_ProWeapon, STATCAT_Advanced);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Awake Ranged Weapons"), STAT_ProWeapon_AwakeInstances, STATGROUP_ProWeapon, SHOOTERPRO_API);
+
+/** 연사 스케줄러가 이번 프레임에 낸 한 발 */
+struct FProScheduledShot
+{
+	// 이 발이 나가야 했던 월드 시간
+	double Timestamp = 0.0;
+
+	// 프레임 안에서의 위치 (0 = 지난 프레임 끝, 1 = 이번 프레임 끝). 총구 위치 보간용
+	float FrameAlpha = 1.0f;
+};
+
+DECLARE_DELEGATE_OneParam(FOnRangedWeaponShotsScheduled, TConstArrayView<FProScheduledShot> /*Shots*/);
 
 UCLASS()
 class SHOOTERPRO_API URangedWeaponInstance : public UWeaponInstance
@@ -17,6 +35,27 @@ public:
 	URangedWeaponInstance(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
 	virtual void Tick(float DeltaSecond) override;
+	virtual void BeginDestroy() override;
+
+	/**
+	 * 탄 퍼짐 갱신을 다시 시작 (발사 시 호출)
+	 * 열/탄 퍼짐/보정값이 모두 수렴하면 스스로 잠들고, 이동 모드/앉기/조준/이동 상태가 바뀌면 Tick에서 깨어난다.
+	 */
+	void WakeUp();
+
+	bool IsAwake() const { return bAwake; }
+
+	/**
+	 * 연사 스케줄러 시작. 이후 Tick마다 FireRate에 맞춰 이번 프레임에 나가야 할 발들을 시간순으로 OnShots에 넘긴다.
+	 * 프레임보다 빠른 연사도 발사 시각을 누적해 한 프레임에 여러 발을 정확한 시각으로 낸다 (발마다 어빌리티를 활성화하지 않음).
+	 */
+	void StartFireSchedule(const FOnRangedWeaponShotsScheduled& OnShots);
+	void StopFireSchedule();
+
+	bool IsFireScheduled() const { return bFireScheduled; }
+
+	/** 한 발을 쏠 때의 열 누적 (HeatToHeatPerShotCurve) 후 탄 퍼짐 갱신 */
+	void AddShotHeat(double ShotTime);
 	
 	int32 GetBulletsPerCartridge() const
 	{
@@ -53,9 +92,46 @@ public:
 		return LineTraceRange;
 	}
 
+	bool UsesHitscanPellets() const
+	{
+		return bHitscanPellets;
+	}
+
+	float GetPelletDamage() const
+	{
+		return PelletDamage;
+	}
+
+	// 탄 퍼짐 방향 생성용 난수 스트림 (장착 시 FWeaponSpreadSampler::MakeStreamSeed로 시드 설정)
+	FRandomStream& GetSpreadRandomStream()
+	{
+		return SpreadRandomStream;
+	}
+
+	// 이번 장착에서 쓰는 탄 퍼짐 시드 (재현/디버그용)
+	UFUNCTION(BlueprintPure, Category="Spread")
+	int32 GetSpreadSeed() const
+	{
+		return SpreadRandomStream.GetInitialSeed();
+	}
+
 	virtual void OnEquipped() override;
 	virtual void OnUnequipped() override;
 
+	/**
+	 * 화면 중앙 조준 트레이스의 캐시된 결과 (장착 중 매 프레임 비동기로 갱신)
+	 * @param MaxAgeFrames 이 프레임 수보다 오래된 결과는 무시
+	 * @return 사용할 수 있는 결과가 있으면 true
+	 */
+	bool GetCachedAimPoint(FVector& OutAimPoint, int32 MaxAgeFrames = 2) const;
+
+	/** 열/탄 퍼짐 커브를 테이블로 굽고 범위를 캐시 (장착 시, 에셋 수정 시) */
+	void BakeWeaponProfile();
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
 protected:
 	
 	// 탄 퍼짐 계수(높을수록 정확도가 올라감.)
@@ -120,6 +196,22 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Weapon Config")
 	int32 BulletsPerCartridge = 1;
 
+	// 탄환 액터 대신 BulletsPerCartridge개의 펠릿을 한 번에 히트스캔으로 처리 (산탄총)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Weapon Config|Hitscan")
+	bool bHitscanPellets = false;
+
+	// 펠릿 한 발의 데미지. 대상별로 합산해 SetByCaller.Damage로 한 번만 적용 (펠릿 모드에서는 필수)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Weapon Config|Hitscan", meta=(EditCondition="bHitscanPellets"))
+	float PelletDamage = 0.0f;
+
+	// 분당 발사 수 (연사 스케줄러 사용 시)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Weapon Config|Fire", meta=(ClampMin=1, ForceUnits=rpm))
+	float FireRate = 600.0f;
+
+	// 프레임이 크게 튀었을 때 한 프레임에 몰아서 낼 수 있는 최대 발 수 (넘는 만큼은 버림)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Weapon Config|Fire", meta=(ClampMin=1))
+	int32 MaxScheduledShotsPerFrame = 8;
+
 	// 탄이 좀 더 곡선으로 나가게 만들게
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Weapon Config", meta=(ForceUnits=cm))
 	float BulletTraceSweepRadius = 0.0f;
@@ -127,22 +219,75 @@ protected:
 	// 총 쏘기 전 라인트레이싱에 사용할 end 거리
 	UPROPERTY(EditAnywhere, Category = "Weapon Config")
 	float LineTraceRange;
+
+	// 장착 시 ProjectileManager 풀에 미리 스폰해 둘 탄환 클래스
+	UPROPERTY(EditAnywhere, Category = "Weapon Config|Pool")
+	TSubclassOf<AProBulletBase> PrewarmBulletClass;
+
+	// 장착 시 미리 스폰해 둘 탄환 수 (연사 속도 * 탄환 수명 정도면 전투 중 스폰이 일어나지 않음)
+	UPROPERTY(EditAnywhere, Category = "Weapon Config|Pool", meta=(ClampMin=0))
+	int32 PrewarmBulletCount = 0;
 	
+	// 조준 트레이스를 비동기로 미리 해 둘지 (끄면 발사 시 동기 트레이스)
+	UPROPERTY(EditAnywhere, Category = "Weapon Config|Aim")
+	bool bUseAsyncAimTrace = true;
+
+	// 조준 트레이스에 BulletTraceSweepRadius 크기의 구 스윕을 사용
+	UPROPERTY(EditAnywhere, Category = "Weapon Config|Aim")
+	bool bSweepAimTrace = false;
+
 private:
-	void ComputeSpreadRange(float& MinSpread, float& MaxSpread);
-	void ComputeHeatRange(float& MinHeat, float& MaxHeat);
+	/** 지난 프레임 조준 트레이스 결과를 받고 이번 프레임 트레이스를 요청 */
+	void UpdateAimTrace();
 
-	inline float ClampHeat(float NewHeat)
-	{
-		float MinHeat;
-		float MaxHeat;
-		ComputeHeatRange( MinHeat, MaxHeat);
+	FTraceHandle PendingAimTrace;
+	FVector PendingAimTraceEnd = FVector::ZeroVector;
+
+	FRandomStream SpreadRandomStream;
 
-		return FMath::Clamp(NewHeat, MinHeat, MaxHeat);
+	FVector CachedAimPoint = FVector::ZeroVector;
+	uint64 CachedAimFrame = 0;
+	bool bHasCachedAim = false;
+
+	void ComputeSpreadRange(float& MinSpread, float& MaxSpread) const;
+	void ComputeHeatRange(float& MinHeat, float& MaxHeat) const;
+
+	inline float ClampHeat(float NewHeat) const
+	{
+		return FMath::Clamp(NewHeat, CachedMinHeat, CachedMaxHeat);
 	}
+
+	// BakeWeaponProfile에서 구운 커브와 범위 (Tick에서는 이것만 읽음)
+	FWeaponCurveLUT HeatToSpreadLUT;
+	FWeaponCurveLUT HeatToHeatPerShotLUT;
+	FWeaponCurveLUT HeatToCoolDownPerSecondLUT;
+
+	float CachedMinHeat = 0.0f;
+	float CachedMaxHeat = 0.0f;
+	float CachedMinSpread = 0.0f;
+	float CachedMaxSpread = 0.0f;
 	
 	bool UpdateSpread(float DeltaSecond);
 	bool UpdateMultipliers(float DeltaSeconds);
+
+	/** 보정값에 영향을 주는 폰 상태를 비트로 묶은 값 (잠든 동안 이것만 비교) */
+	uint8 ComputeSettleFingerprint(const APawn* Pawn) const;
+
+	/** 열, 탄 퍼짐이 최소이고 보정값이 현재 목표값에 수렴했으면 잠든다 */
+	void TrySleep(const APawn* Pawn, bool bIsMinSpread);
+
+	void SetAwake(bool bNewAwake);
+
+	bool bAwake = false;
+	uint8 SettledFingerprint = 0;
+
+	/** 이번 프레임에 나가야 할 발들을 모아 OnScheduledShots로 넘긴다 */
+	void UpdateFireSchedule(float DeltaSecond);
+
+	FOnRangedWeaponShotsScheduled OnScheduledShots;
+	TArray<FProScheduledShot> ScheduledShots;
+	double NextShotTime = 0.0;
+	bool bFireScheduled = false;
 	
 	double LastFireTime = 0.0;
 
@@ -160,4 +305,7 @@ private:
 
 	float CrouchingMultiplier = 1.0f;
 
+	/** 보간되는 보정값이 모두 현재 목표값에 도달했는지 (UpdateMultipliers에서 갱신) */
+	bool bMultipliersSettled = false;
+
 };
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Curves/RichCurve.h"
+
+/**
+ * FWeaponCurveLUT
+ *
+ * 무기 커브(FRuntimeFloatCurve)를 고정 크기 테이블로 구워 둔 것입니다.
+ * - 장착/에셋 수정 시 한 번 Bake하고, Tick에서는 키 탐색 없이 두 샘플 사이 선형 보간만 합니다.
+ * - 입력 범위 밖은 양 끝 값으로 고정됩니다 (열은 항상 범위 안으로 Clamp되므로 커브의 외삽과 같음).
+ */
+struct FWeaponCurveLUT
+{
+public:
+	static constexpr int32 NumSamples = 128;
+
+	bool IsBaked() const { return bBaked; }
+
+	void Bake(const FRichCurve& Curve, float InMinTime, float InMaxTime)
+	{
+		MinTime = InMinTime;
+		MaxTime = FMath::Max(InMaxTime, InMinTime);
+
+		const float Range = MaxTime - MinTime;
+		const float Step = Range / (NumSamples - 1);
+		InvStep = Step > UE_SMALL_NUMBER ? 1.0f / Step : 0.0f;
+
+		for (int32 Index = 0; Index < NumSamples; ++Index)
+		{
+			Samples[Index] = Curve.Eval(MinTime + Step * Index);
+		}
+
+		bBaked = true;
+	}
+
+	float Eval(float Time) const
+	{
+		const float Position = FMath::Clamp((Time - MinTime) * InvStep, 0.0f, static_cast<float>(NumSamples - 1));
+		const int32 Index = FMath::Min(static_cast<int32>(Position), NumSamples - 2);
+		return FMath::Lerp(Samples[Index], Samples[Index + 1], Position - Index);
+	}
+
+	void Reset() { bBaked = false; }
+
+private:
+	float Samples[NumSamples] = {};
+	float MinTime = 0.0f;
+	float MaxTime = 0.0f;
+	float InvStep = 0.0f;
+	bool bBaked = false;
+};
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * FWeaponSpreadSampler
+ *
+ * 탄 퍼짐 원뿔 안의 방향을 무기별 FRandomStream으로 생성합니다.
+ * - 중심각 = ConeHalfAngleRad * Rand^Exponent, 회전각 = 균등 (기존 RandConeNormalDistribution과 같은 분포)
+ * - 쿼터니언 없이 조준 방향의 직교 기저로 직접 구성하고, 4발씩 묶어 SIMD로 Pow/SinCos를 계산합니다.
+ * - 난수는 발 순서대로 (중심각, 회전각) 쌍으로 뽑으므로 한 발씩 뽑든 묶어서 뽑든 같은 스트림이면 같은 결과가 나옵니다.
+ *
+ * 결정적 모드:
+ * - 무기 스트림의 시드는 세션 기준 시드 + 무기 클래스 + 소유자 이름으로 만듭니다 (MakeStreamSeed).
+ * - 기준 시드는 "ShooterPro.Weapon.SpreadSeed"로 고정할 수 있고, 0이면 세션마다 무작위로 정한 뒤 로그에 남깁니다.
+ *   로그에 찍힌 값을 그대로 넣고 같은 입력을 재생하면 교전 전체의 탄 퍼짐이 재현됩니다.
+ */
+struct SHOOTERPRO_API FWeaponSpreadSampler
+{
+public:
+	static constexpr int32 BatchSize = 4;
+
+	/** 원뿔 안의 방향 하나 */
+	static FVector SampleCone(const FVector& Dir, float ConeHalfAngleRad, float Exponent, FRandomStream& Stream);
+
+	/** 원뿔 안의 방향을 OutDirections 개수만큼 */
+	static void SampleConeBatch(const FVector& Dir, float ConeHalfAngleRad, float Exponent, FRandomStream& Stream, TArrayView<FVector> OutDirections);
+
+	/** 세션 기준 시드 (콘솔 변수가 0이면 처음 호출할 때 무작위로 정해 로그에 남김) */
+	static int32 GetBaseSeed();
+
+	/** 무기 스트림 시드. 같은 기준 시드/무기 클래스/소유자면 항상 같은 값 */
+	static int32 MakeStreamSeed(const UObject* Weapon, const UObject* Owner);
+};
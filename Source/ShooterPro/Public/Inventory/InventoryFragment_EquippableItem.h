@@ -13,6 +13,9 @@ class SHOOTERPRO_API UInventoryFragment_EquippableItem : public UInventoryItemFr
 {
 	GENERATED_BODY()
 public:
+	// 획득하자마자 장비의 어빌리티 세트 에셋을 미리 스트리밍 (처음 장착할 때 동기 로드 방지)
+	virtual void OnInstanceCreated(UInventoryItemInstance* Instance) const override;
+
 	UPROPERTY(EditAnywhere, Category = Inventory)
 	TSubclassOf<UEquipmentDefinition> EquipmentDefinition;
 };
@@ -10,6 +10,8 @@
 class UInventoryItemDefinition;
 struct FGamplayTag;
 
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_FourParams(FOnInventoryStatTagChanged, UInventoryItemInstance*, ItemInstance, FGameplayTag, Tag, int32, NewCount, int32, OldCount);
+
 
 UCLASS(BlueprintType, Blueprintable)
 class SHOOTERPRO_API UInventoryItemInstance : public UObject
@@ -19,6 +21,11 @@ class SHOOTERPRO_API UInventoryItemInstance : public UObject
 public:
 	UInventoryItemInstance(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
+	//~UObject interface
+	virtual bool IsSupportedForNetworking() const override { return true; }
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+	//~End of UObject interface
+
 	UFUNCTION(BlueprintCallable, Category = "Inventory")
 	TSubclassOf<UInventoryItemDefinition> GetItemDef() const { return ItemDef; }
 
@@ -29,11 +36,19 @@ public:
 	
 	UFUNCTION(BlueprintCallable, Category = "Inventory")
 	void RemoveStatTagStack(FGameplayTag Tag, int32 StackCount)	{ StatTags.RemoveStack(Tag, StackCount); }
+
+	// 여러 스탯 태그를 한 번에 증감 (음수는 제거)
+	UFUNCTION(BlueprintCallable, Category = "Inventory")
+	void ApplyStatTagDeltas(const TMap<FGameplayTag, int32>& Deltas) { StatTags.ApplyStackDeltas(Deltas); }
 	
 	UFUNCTION(BlueprintCallable, Category = "Inventory")
 	int32 GetStatTagStackCount(FGameplayTag Tag) const	{ return StatTags.GetStackCount(Tag); }
 
 	bool HasStatTag(FGameplayTag Tag) const	{ return StatTags.ContainsTag(Tag);	}
+
+	// 스탯 태그(탄약 등) 개수 변경. 클라이언트에서는 복제 받았을 때 호출됨
+	UPROPERTY(BlueprintAssignable, Category = "Inventory")
+	FOnInventoryStatTagChanged OnStatTagChanged;
 	
 	friend struct FInventoryList;
 
@@ -47,9 +62,12 @@ public:
 	}
 
 private:
-	UPROPERTY()
+	void HandleStatTagChanged(FGameplayTag Tag, int32 NewCount, int32 OldCount);
+
+	UPROPERTY(Replicated)
 	FGameplayTagStackContainer StatTags;
 
+	UPROPERTY(Replicated)
 	TSubclassOf<UInventoryItemDefinition> ItemDef;
 };
 
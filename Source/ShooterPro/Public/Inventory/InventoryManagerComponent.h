@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "Net/Serialization/FastArraySerializer.h"
 #include "InventoryManagerComponent.generated.h"
 
 class UInventoryManagerComponent;
@@ -10,8 +11,11 @@ class UInventoryItemInstance;
 
 struct FInventoryList;
 
+// 아이템 스택 개수 변경 (서버는 변경 즉시, 클라이언트는 복제 받았을 때). 제거되면 NewCount = 0
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnInventoryItemChanged, UInventoryItemInstance*, ItemInstance, int32, NewCount, int32, OldCount);
+
 USTRUCT(BlueprintType)
-struct FInventoryItem
+struct FInventoryItem : public FFastArraySerializerItem
 {
 	GENERATED_BODY()
 
@@ -29,16 +33,28 @@ private:
 	UPROPERTY()
 	int32 StackCount = 0;
 
+	// 서버에서 추가될 때마다 증가하는 순번. 클라이언트는 이 값으로 인덱스 조회 순서를 서버와 맞춤
+	UPROPERTY()
+	int32 SlotOrder = 0;
+
 	//UPROPERTY()
 	//int32 MaxStackCount; ItemDef에서 값을 가져와야함.
 
-	UPROPERTY()
+	// 클라이언트에서 변경 콜백의 이전 값으로 사용 (복제 안 함)
+	UPROPERTY(NotReplicated)
 	int32 LastObservedCount = INDEX_NONE;
 };
 
 
+/**
+ * 인벤토리 아이템 목록
+ * - FFastArraySerializer로 바뀐 항목만 복제합니다 (스택 개수 변경 시 그 항목 하나만 전송).
+ * - IndexByDefinition/Version은 복제하지 않고 클라이언트에서 받은 뒤 다시 만듭니다.
+ * - FastArray는 클라이언트에서 제거를 스왑으로 처리하므로 클라이언트의 Items 순서는 서버와 다를 수 있습니다.
+ *   인덱스 조회(GetInstanceAt/GetAllItems)는 항목마다 복제되는 SlotOrder로 정렬한 로컬 인덱스를 거쳐 양쪽이 같은 순서를 봅니다.
+ */
 USTRUCT(BlueprintType)
-struct FInventoryList
+struct FInventoryList : public FFastArraySerializer
 {
 	GENERATED_BODY()
 
@@ -64,14 +80,80 @@ struct FInventoryList
 
 	FInventoryItem FindItemByDefinition(const TSubclassOf<UInventoryItemDefinition>& ItemDef) const;
 
+	UInventoryItemInstance* FindInstanceByDefinition(const TSubclassOf<UInventoryItemDefinition>& ItemDef) const;
+
+	// 추가된 순서 기준 인덱스 (제거되면 뒤쪽 아이템이 한 칸씩 당겨짐)
+	UInventoryItemInstance* GetInstanceAt(int32 Index) const
+	{
+		return SlotOrderIndices.IsValidIndex(Index) ? Items[SlotOrderIndices[Index]].Instance.Get() : nullptr;
+	}
+
+	int32 Num() const
+	{
+		return Items.Num();
+	}
+
+	// 아이템 추가/제거/개수 변경마다 증가 (UI가 바뀐 게 없으면 다시 만들지 않도록)
+	uint32 GetVersion() const
+	{
+		return Version;
+	}
+
+	//~FFastArraySerializer contract
+	void PreReplicatedRemove(const TArrayView<int32> RemovedIndices, int32 FinalSize);
+	void PostReplicatedAdd(const TArrayView<int32> AddedIndices, int32 FinalSize);
+	void PostReplicatedChange(const TArrayView<int32> ChangedIndices, int32 FinalSize);
+	void PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters);
+	//~End of FFastArraySerializer contract
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FFastArraySerializer::FastArrayDeltaSerialize<FInventoryItem, FInventoryList>(Items, DeltaParms, *this);
+	}
+
+private:
+	int32 FindIndex(const TSubclassOf<UInventoryItemDefinition>& ItemDef) const
+	{
+		const int32* Index = IndexByDefinition.Find(ItemDef);
+		return Index ? *Index : INDEX_NONE;
+	}
+
+	void RemoveAtIndex(int32 Index);
+
+	void RebuildIndex();
+
+	// Version을 올리고 컴포넌트의 OnInventoryItemChanged 호출
+	void NotifyChanged(UInventoryItemInstance* Instance, int32 NewCount, int32 OldCount);
+
 private:
+	// 빈틈 없이 보관 (서버는 추가된 순서, 클라이언트는 복제 순서)
 	UPROPERTY()
-	TMap<TSubclassOf<UInventoryItemDefinition>, FInventoryItem> Items;
+	TArray<FInventoryItem> Items;
+
+	// 정의 -> Items 인덱스
+	TMap<TSubclassOf<UInventoryItemDefinition>, int32> IndexByDefinition;
+
+	uint32 Version = 0;
+
+	// SlotOrder 순으로 정렬한 Items 인덱스 (복제하지 않음)
+	TArray<int32> SlotOrderIndices;
+
+	// 다음에 추가될 아이템의 SlotOrder (서버 전용)
+	int32 NextSlotOrder = 0;
 	
-	UPROPERTY()
+	UPROPERTY(NotReplicated)
 	TObjectPtr<UActorComponent> OwnerComponent;
 };
 
+template<>
+struct TStructOpsTypeTraits<FInventoryList> : public TStructOpsTypeTraitsBase2<FInventoryList>
+{
+	enum
+	{
+		WithNetDeltaSerializer = true,
+	};
+};
+
 
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
 class SHOOTERPRO_API UInventoryManagerComponent : public UActorComponent
@@ -81,6 +163,11 @@ class SHOOTERPRO_API UInventoryManagerComponent : public UActorComponent
 public:
 	UInventoryManagerComponent(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
+	//~UActorComponent interface
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+	virtual void ReadyForReplication() override;
+	//~End of UActorComponent interface
+
 	UFUNCTION(BlueprintCallable, Category="Inventory")
 	UInventoryItemInstance* AddItemDefinition(TSubclassOf<UInventoryItemDefinition> ItemDef, int32 StakcCount = 1);
 
@@ -116,8 +203,19 @@ public:
 
 	UFUNCTION(BlueprintPure, Category="Inventory")
 	TArray<UInventoryItemInstance*> GetAllItems() ;
+
+	UFUNCTION(BlueprintPure, Category="Inventory")
+	int32 GetNumItems() const;
+
+	// 인벤토리가 바뀔 때마다 증가. UI는 마지막으로 본 값과 같으면 다시 만들 필요 없음
+	UFUNCTION(BlueprintPure, Category="Inventory")
+	int32 GetInventoryVersion() const;
+
+	UPROPERTY(BlueprintAssignable, Category="Inventory")
+	FOnInventoryItemChanged OnInventoryItemChanged;
 	
 private:
+	UPROPERTY(Replicated)
 	FInventoryList InventoryList;
 };
 
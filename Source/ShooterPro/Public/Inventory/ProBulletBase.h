@@ -6,6 +6,7 @@
 #include "ProBulletBase.generated.h"
 
 class UGameplayEffect;
+class UProjectileManagerComponent;
 class UProjectileMovementComponent;
 class USphereComponent;
 
@@ -30,6 +31,23 @@ public:
 	UFUNCTION(BlueprintCallable)
 	void DeactivateBullet();
 
+	// 풀 관리용 (UProjectileManagerComponent)
+	void SetOwningPool(UProjectileManagerComponent* Pool) { OwningPool = Pool; }
+	void SetPooledInUse(bool bInUse) { bPooledInUse = bInUse; }
+	bool IsPooledInUse() const { return bPooledInUse; }
+	uint32 GetActivationSerial() const { return ActivationSerial; }
+	uint32 IncrementActivationSerial() { return ++ActivationSerial; }
+	float GetMaxLifetime() const { return MaxLifetime; }
+	float GetMaxRange() const { return MaxRange; }
+
+	// 액터 없이 UBallisticSimulationSubsystem으로 시뮬레이션할 때 CDO에서 읽는 값
+	bool ShouldSimulateWithoutActor() const { return bSimulateWithoutActor; }
+	TSubclassOf<UGameplayEffect> GetDamageEffect() const { return DamageEffect; }
+	UProjectileMovementComponent* GetProjectileMovement() const { return ProjectileMovement; }
+	float GetCollisionRadius() const;
+	ECollisionChannel GetCollisionObjectType() const;
+	FCollisionResponseContainer GetCollisionResponses() const;
+
 protected:
 	UFUNCTION(BlueprintImplementableEvent)
 	void K2_ActivateBullet(AActor* Avatar, const FVector& SpawnLocation, const FRotator& SpawnRotation, const FVector& Direction, const float Speed = 2000.0f);
@@ -62,4 +80,26 @@ protected:
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Projectile|Config", meta=(ExposeOnSpawn=true))
 	TSubclassOf<UGameplayEffect> DamageEffect;
+
+	// 액터를 스폰하지 않고 UBallisticSimulationSubsystem에서 구조체로 시뮬레이션 (BP 이벤트는 호출되지 않음)
+	UPROPERTY(EditDefaultsOnly, Category="Projectile|Config")
+	bool bSimulateWithoutActor = false;
+
+	// 발사 후 풀로 돌아가기까지의 최대 시간 (0이면 시간 제한 없음)
+	UPROPERTY(EditDefaultsOnly, Category="Projectile|Lifetime", meta=(ClampMin=0, ForceUnits=s))
+	float MaxLifetime = 5.0f;
+
+	// 최대 사거리 (0이면 제한 없음). 발사 속력으로 나눠 시간으로 환산해 MaxLifetime과 함께 적용
+	UPROPERTY(EditDefaultsOnly, Category="Projectile|Lifetime", meta=(ClampMin=0, ForceUnits=cm))
+	float MaxRange = 0.0f;
+
+private:
+	// 이 탄환을 스폰한 풀
+	TWeakObjectPtr<UProjectileManagerComponent> OwningPool;
+
+	// 풀에서 꺼내져 사용 중인지 (비활성화 시 한 번만 반납되도록)
+	bool bPooledInUse = false;
+
+	// 발사할 때마다 증가. 수명 휠에 남은 이전 발사의 만료 항목을 걸러내는 데 사용
+	uint32 ActivationSerial = 0;
 };
@@ -0,0 +1,154 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WorldCollision.h"
+#include "BallisticSimulationSubsystem.generated.h"
+
+class UGameplayEffect;
+class UInstancedStaticMeshComponent;
+class UStaticMesh;
+struct FStreamableHandle;
+
+DECLARE_STATS_GROUP(TEXT("ShooterPro Projectile"), STATGROUP_ProProjectile, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Simulated Bullets"), STAT_ProProjectile_SimulatedBullets, STATGROUP_ProProjectile, SHOOTERPRO_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Async Sweeps"), STAT_ProProjectile_AsyncSweeps, STATGROUP_ProProjectile, SHOOTERPRO_API);
+
+/** 액터 없이 시뮬레이션할 탄환 한 발의 발사 정보 */
+USTRUCT(BlueprintType)
+struct SHOOTERPRO_API FProBallisticShot
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(BlueprintReadWrite, Category="Ballistic")
+	TObjectPtr<AActor> Instigator = nullptr;
+
+	UPROPERTY(BlueprintReadWrite, Category="Ballistic")
+	FVector Start = FVector::ZeroVector;
+
+	UPROPERTY(BlueprintReadWrite, Category="Ballistic")
+	FVector Direction = FVector::ForwardVector;
+
+	UPROPERTY(BlueprintReadWrite, Category="Ballistic")
+	float Speed = 2000.0f;
+
+	UPROPERTY(BlueprintReadWrite, Category="Ballistic")
+	float GravityScale = 0.0f;
+
+	UPROPERTY(BlueprintReadWrite, Category="Ballistic")
+	float Radius = 5.0f;
+
+	/** 스윕 채널과 채널별 반응. 액터 탄환과 같은 대상에 막히도록 탄환 CDO의 충돌 컴포넌트 값을 넣는다 */
+	UPROPERTY(BlueprintReadWrite, Category="Ballistic")
+	TEnumAsByte<ECollisionChannel> CollisionChannel = ECC_WorldDynamic;
+
+	UPROPERTY(BlueprintReadWrite, Category="Ballistic")
+	FCollisionResponseContainer CollisionResponses;
+
+	UPROPERTY(BlueprintReadWrite, Category="Ballistic")
+	TSubclassOf<UGameplayEffect> DamageEffect;
+};
+
+/**
+ * 플레이어 탄환을 액터 없이 구조체(SoA)로 시뮬레이션하는 서브시스템
+ * - 매 Tick 모든 탄환의 다음 위치를 ParallelFor로 계산하고, 탄환마다 비동기 스윕을 한 번씩 요청한다.
+ * - 스윕 결과는 다음 Tick에 받아서 맞은 대상에게 AProBulletBase와 같은 DamageEffect를 적용한다.
+ * - 눈에 보이는 부분은 인스턴스드 스태틱 메시 트레이서 하나로 그린다 (TracerMesh 미지정 시 생략, 서브시스템 생성 시 비동기로 로드).
+ * - 액터/컴포넌트 Tick, 프레임당 동기 스윕이 없어 연사와 산탄 상황에서 비용이 크게 줄어든다.
+ */
+UCLASS(Config=Game)
+class SHOOTERPRO_API UBallisticSimulationSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	//~ Begin UWorldSubsystem interface
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	//~ End UWorldSubsystem interface
+
+	//~ Begin FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override { return NumActiveBullets > 0 || bTracersVisible; }
+	virtual TStatId GetStatId() const override;
+	//~ End FTickableGameObject interface
+
+public:
+	/** 탄환 한 발 발사 */
+	UFUNCTION(BlueprintCallable, Category="Ballistic")
+	void FireBullet(const FProBallisticShot& Shot);
+
+	UFUNCTION(BlueprintPure, Category="Ballistic")
+	int32 GetNumActiveBullets() const { return NumActiveBullets; }
+
+private:
+	int32 AllocateSlot();
+	void FreeSlot(int32 Slot);
+
+	/** 지난 Tick에 요청한 스윕 결과 처리 (명중 시 데미지 적용 후 제거, 아니면 위치 확정. 결과가 없으면 동기 스윕으로 대신 확인) */
+	void ResolvePendingSweeps();
+
+	/** 다음 위치 계산 (워커 스레드 병렬) */
+	void AdvanceBullets(float DeltaTime);
+
+	void IssueSweeps();
+
+	/** Positions -> PendingPositions 구간 동기 스윕 (비동기 결과를 받지 못한 경우) */
+	bool SweepSegment(int32 Slot, FHitResult& OutHit) const;
+	FCollisionQueryParams MakeSweepQueryParams(int32 Slot) const;
+
+	void ApplyDamage(int32 Slot, const FHitResult& Hit) const;
+
+	void UpdateTracers();
+	UInstancedStaticMeshComponent* GetOrCreateTracerComponent();
+
+protected:
+	/** 탄환 최대 비행 시간 (초) */
+	UPROPERTY(Config)
+	float MaxBulletLifetime = 3.0f;
+
+	/** 트레이서 메시 (X축 방향 길이 100 기준) */
+	UPROPERTY(Config)
+	TSoftObjectPtr<UStaticMesh> TracerMesh;
+
+	UPROPERTY(Config)
+	float TracerLength = 150.0f;
+
+	UPROPERTY(Config)
+	float TracerWidth = 0.05f;
+
+private:
+	// SoA 레이아웃 (슬롯 인덱스로 접근)
+	TArray<FVector> Positions;
+	TArray<FVector> Velocities;
+	TArray<FVector> PendingPositions;
+	TArray<FVector> PendingVelocities;
+	TArray<float> GravityZs;
+	TArray<float> Radii;
+	TArray<TEnumAsByte<ECollisionChannel>> CollisionChannels;
+	TArray<FCollisionResponseParams> CollisionResponses;
+	TArray<float> RemainingLifetimes;
+	TArray<FTraceHandle> PendingSweeps;
+	TArray<TWeakObjectPtr<AActor>> Instigators;
+	TArray<TSubclassOf<UGameplayEffect>> DamageEffects;
+	TArray<bool> SlotActive;
+
+	TArray<int32> FreeSlots;
+	int32 NumActiveBullets = 0;
+
+	UPROPERTY(Transient)
+	TObjectPtr<AActor> TracerActor;
+
+	UPROPERTY(Transient)
+	TObjectPtr<UInstancedStaticMeshComponent> TracerComponent;
+
+	TArray<FTransform> TracerTransforms;
+
+	/** 트레이서 메시 로드 핸들 (로드되기 전에는 트레이서 없이 시뮬레이션만) */
+	TSharedPtr<FStreamableHandle> TracerMeshHandle;
+
+	/** 마지막 탄환이 사라진 뒤 한 번 더 갱신해 트레이서를 숨기기 위함 */
+	bool bTracersVisible = false;
+};
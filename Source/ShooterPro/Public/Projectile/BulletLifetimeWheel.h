@@ -0,0 +1,119 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class AProBulletBase;
+
+/**
+ * FBulletLifetimeWheel
+ *
+ * 풀링된 탄환의 만료 시각을 관리하는 계층형 타이밍 휠입니다.
+ * - 탄환마다 타이머를 두지 않고, 만료 틱에 해당하는 슬롯에 넣어 두었다가 그 틱이 되면 한 번에 꺼냅니다.
+ * - 0단계는 1틱 단위 64칸, 1단계는 64틱 단위 64칸, 2단계는 4096틱 단위 64칸이며 윗단계 칸은 차례가 되면 아랫단계로 내려옵니다.
+ * - 등록/만료 모두 O(1)이고, 일찍 반납된 탄환의 항목은 Serial로 걸러냅니다.
+ */
+struct FBulletLifetimeWheel
+{
+public:
+	struct FEntry
+	{
+		TWeakObjectPtr<AProBulletBase> Bullet;
+		uint32 Serial = 0;
+		uint64 ExpireTick = 0;
+	};
+
+	static constexpr int32 SlotBits = 6;
+	static constexpr int32 NumSlots = 1 << SlotBits;
+	static constexpr uint64 SlotMask = NumSlots - 1;
+	static constexpr int32 NumLevels = 3;
+	static constexpr uint64 MaxDelayTicks = (1ull << (SlotBits * NumLevels)) - 1;
+
+	bool IsEmpty() const { return NumEntries == 0; }
+	int32 Num() const { return NumEntries; }
+	uint64 GetCurrentTick() const { return CurrentTick; }
+
+	/** 비어 있을 때 현재 틱을 맞춘다 (빈 휠을 한 틱씩 돌리지 않도록) */
+	void SyncIfEmpty(uint64 NowTick)
+	{
+		if (NumEntries == 0)
+			CurrentTick = FMath::Max(CurrentTick, NowTick);
+	}
+
+	void Schedule(const TWeakObjectPtr<AProBulletBase>& Bullet, uint32 Serial, uint64 DelayTicks)
+	{
+		FEntry Entry;
+		Entry.Bullet = Bullet;
+		Entry.Serial = Serial;
+		Entry.ExpireTick = CurrentTick + FMath::Clamp<uint64>(DelayTicks, 1, MaxDelayTicks);
+		Insert(MoveTemp(Entry));
+		++NumEntries;
+	}
+
+	/** NowTick까지 돌리며 만료된 항목마다 OnExpired(const FEntry&) 호출 */
+	template <typename FuncType>
+	void Advance(uint64 NowTick, FuncType&& OnExpired)
+	{
+		while (CurrentTick < NowTick && NumEntries > 0)
+		{
+			++CurrentTick;
+
+			// 윗단계 칸이 차례가 되면 아랫단계로 내림 (높은 단계부터)
+			if ((CurrentTick & SlotMask) == 0)
+			{
+				if (((CurrentTick >> SlotBits) & SlotMask) == 0)
+					Cascade(2);
+				Cascade(1);
+			}
+
+			TArray<FEntry>& Slot = Slots[0][CurrentTick & SlotMask];
+			if (Slot.Num() == 0)
+				continue;
+
+			// 콜백 안에서 다시 Schedule될 수 있으므로 먼저 비워둔다
+			TArray<FEntry> Expired = MoveTemp(Slot);
+			Slot.Reset();
+			NumEntries -= Expired.Num();
+
+			for (const FEntry& Entry : Expired)
+			{
+				OnExpired(Entry);
+			}
+		}
+
+		CurrentTick = FMath::Max(CurrentTick, NowTick);
+	}
+
+private:
+	void Insert(FEntry&& Entry)
+	{
+		const uint64 Delta = Entry.ExpireTick - CurrentTick;
+		if (Delta < NumSlots)
+		{
+			Slots[0][Entry.ExpireTick & SlotMask].Add(MoveTemp(Entry));
+		}
+		else if (Delta < (1ull << (SlotBits * 2)))
+		{
+			Slots[1][(Entry.ExpireTick >> SlotBits) & SlotMask].Add(MoveTemp(Entry));
+		}
+		else
+		{
+			Slots[2][(Entry.ExpireTick >> (SlotBits * 2)) & SlotMask].Add(MoveTemp(Entry));
+		}
+	}
+
+	void Cascade(int32 Level)
+	{
+		TArray<FEntry>& Slot = Slots[Level][(CurrentTick >> (SlotBits * Level)) & SlotMask];
+		TArray<FEntry> Moving = MoveTemp(Slot);
+		Slot.Reset();
+
+		for (FEntry& Entry : Moving)
+		{
+			Insert(MoveTemp(Entry));
+		}
+	}
+
+	TArray<FEntry> Slots[NumLevels][NumSlots];
+	uint64 CurrentTick = 0;
+	int32 NumEntries = 0;
+};
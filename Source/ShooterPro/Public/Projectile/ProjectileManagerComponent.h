@@ -4,11 +4,36 @@
 
 #include "CoreMinimal.h"
 #include "Components/PawnComponent.h"
+#include "Projectile/BulletLifetimeWheel.h"
 #include "ProjectileManagerComponent.generated.h"
 
 class AProBulletBase;
+
+/**
+ * 탄환 클래스 하나에 대한 풀
+ * - FreeBullets는 비활성 탄환 스택으로, 꺼내고 넣는 데 O(1)
+ * - 사용 중인 탄환은 탄환 쪽 플래그(IsPooledInUse)와 NumInUse로 추적
+ */
+USTRUCT()
+struct FProBulletPool
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY()
+	TArray<TObjectPtr<AProBulletBase>> FreeBullets;
+
+	// 이 풀에서 스폰한 전체 탄환 수 (사용 중 + 대기 중)
+	int32 NumSpawned = 0;
+
+	int32 NumInUse = 0;
+
+	// 동시에 사용 중이었던 최대 탄환 수
+	int32 HighWaterMark = 0;
+};
+
 /**
- * 
+ * 폰이 쏘는 탄환(AProBulletBase)을 클래스별로 재사용하는 풀
  */
 UCLASS()
 class SHOOTERPRO_API UProjectileManagerComponent : public UPawnComponent
@@ -19,8 +44,10 @@ public:
 	UProjectileManagerComponent(const FObjectInitializer& ObjectInitializer);
 
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 	
-	// 풀에서 탄환을 가져옴 (필요시 스폰)
+	// 풀에서 탄환을 가져옴 (필요시 스폰). MaxBulletsPerClass에 도달했다면 nullptr
 	UFUNCTION(BlueprintCallable)
 	AProBulletBase* RequestBullet(TSubclassOf<AProBulletBase> BulletClass);
 
@@ -28,12 +55,49 @@ public:
 	UFUNCTION(BlueprintCallable)
 	void ReleaseBullet(AProBulletBase* Bullet);
 
+	// 대기 중인 탄환이 Count개가 되도록 미리 스폰해 둠 (무기 장착 시 호출)
+	UFUNCTION(BlueprintCallable)
+	void Prewarm(TSubclassOf<AProBulletBase> BulletClass, int32 Count);
+
+	UFUNCTION(BlueprintPure)
+	int32 GetNumBulletsInUse(TSubclassOf<AProBulletBase> BulletClass) const;
+
+	UFUNCTION(BlueprintPure)
+	int32 GetHighWaterMark(TSubclassOf<AProBulletBase> BulletClass) const;
+
+	// 모든 클래스의 사용 중인 탄환 수
+	UFUNCTION(BlueprintPure)
+	int32 GetNumLiveBullets() const { return NumLiveBullets; }
+
+	// 탄환이 발사되면 탄환 쪽에서 호출 (AProBulletBase::ActivateBullet). 수명/사거리 만료를 예약
+	void NotifyBulletActivated(AProBulletBase* Bullet, float Speed);
+
+	// 탄환이 비활성화되면 탄환 쪽에서 호출 (AProBulletBase::DeactivateBullet)
+	void NotifyBulletDeactivated(AProBulletBase* Bullet);
+
 public:
 	UPROPERTY(EditDefaultsOnly, Category=Ammo)
 	TSubclassOf<AProBulletBase> ProjectileActorClass;
 
+	// 클래스별 최대 탄환 수 (0이면 제한 없음)
+	UPROPERTY(EditDefaultsOnly, Category=Ammo, meta=(ClampMin=0))
+	int32 MaxBulletsPerClass = 0;
+
+	// 수명 타이밍 휠의 한 틱 길이 (초). 만료 시각은 이 단위로 올림된다
+	UPROPERTY(EditDefaultsOnly, Category=Ammo, meta=(ClampMin=0.005, ForceUnits=s))
+	float LifetimeTickInterval = 0.05f;
+
 protected:
+	AProBulletBase* SpawnPooledBullet(TSubclassOf<AProBulletBase> BulletClass);
+
+	uint64 GetLifetimeTick() const;
+
 	UPROPERTY()
-	TArray<AProBulletBase*> BulletPool; // 이미 스폰된 탄환 목록
+	TMap<TSubclassOf<AProBulletBase>, FProBulletPool> BulletPools; // 클래스별 탄환 풀
+
+	// 사용 중인 탄환의 수명/사거리 만료 관리 (탄환별 타이머 없음)
+	FBulletLifetimeWheel LifetimeWheel;
+
+	int32 NumLiveBullets = 0;
 	
 };
@@ -4,14 +4,46 @@
 
 #include "CoreMinimal.h"
 #include "GameplayTagContainer.h"
+#include "Net/Serialization/FastArraySerializer.h"
 #include "UObject/NoExportTypes.h"
 #include "GameplayTagStackContainer.generated.h"
 
+struct FGameplayTagStackContainer;
+
+// 태그 스택 개수가 바뀜 (서버는 변경 즉시, 클라이언트는 복제 받았을 때). 제거되면 NewCount = 0
+DECLARE_MULTICAST_DELEGATE_ThreeParams(FOnGameplayTagStackChanged, FGameplayTag /*Tag*/, int32 /*NewCount*/, int32 /*OldCount*/);
+
+/**
+ * 태그 하나의 스택 (FastArray 항목)
+ */
+USTRUCT(BlueprintType)
+struct FGameplayTagStack : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	FGameplayTagStack() {}
+
+	FGameplayTagStack(FGameplayTag InTag, int32 InStackCount) : Tag(InTag), StackCount(InStackCount) {}
+
+private:
+	friend FGameplayTagStackContainer;
+
+	UPROPERTY()
+	FGameplayTag Tag;
+
+	UPROPERTY()
+	int32 StackCount = 0;
+};
+
 /**
- * 
+ * 태그별 스택 개수 (탄약 등)
+ * - FFastArraySerializer로 바뀐 항목만 복제합니다. 발사마다 탄약이 줄어도 그 태그 하나만 전송됩니다.
+ * - 조회는 태그 이름(FName 인덱스) 순으로 정렬된 인라인 배열에서 이진 탐색 한 번으로 끝납니다.
+ *   아이템의 스탯 태그는 보통 8개 미만이라 힙 할당도, 해시도 없습니다.
+ * - 조회용 배열은 복제하지 않고 양쪽에서 각자 유지합니다.
  */
 USTRUCT(BlueprintType)
-struct SHOOTERPRO_API FGameplayTagStackContainer
+struct SHOOTERPRO_API FGameplayTagStackContainer : public FFastArraySerializer
 {
 	GENERATED_BODY()
 	FGameplayTagStackContainer() {}
@@ -20,16 +52,90 @@ struct SHOOTERPRO_API FGameplayTagStackContainer
 
 	void RemoveStack(FGameplayTag Tag, int32 StackCount);
 
+	/** 여러 태그의 증감을 한 번에 (양수는 AddStack, 음수는 RemoveStack). TMap이나 TPair 배열을 그대로 넘길 수 있음 */
+	template <typename DeltaRangeType>
+	void ApplyStackDeltas(const DeltaRangeType& Deltas)
+	{
+		for (const auto& Delta : Deltas)
+		{
+			if (Delta.Value > 0)
+				AddStack(Delta.Key, Delta.Value);
+			else if (Delta.Value < 0)
+				RemoveStack(Delta.Key, -Delta.Value);
+		}
+	}
+
+	/** 모든 태그가 요구 개수 이상 있는지 */
+	template <typename CountRangeType>
+	bool HasStacks(const CountRangeType& Counts) const
+	{
+		for (const auto& Count : Counts)
+		{
+			if (GetStackCount(Count.Key) < Count.Value)
+				return false;
+		}
+		return true;
+	}
+
 	int32 GetStackCount(FGameplayTag Tag) const
 	{
-		if (!TagMap.Contains(Tag)) return 0;
-		return TagMap.FindRef(Tag);
+		const int32 LookupIndex = FindLookupIndex(Tag);
+		return LookupIndex != INDEX_NONE ? Lookup[LookupIndex].Count : 0;
 	}
 
 	bool ContainsTag(FGameplayTag Tag) const
 	{
-		return TagMap.Contains(Tag);
+		return FindLookupIndex(Tag) != INDEX_NONE;
+	}
+
+	//~FFastArraySerializer contract
+	void PreReplicatedRemove(const TArrayView<int32> RemovedIndices, int32 FinalSize);
+	void PostReplicatedAdd(const TArrayView<int32> AddedIndices, int32 FinalSize);
+	void PostReplicatedChange(const TArrayView<int32> ChangedIndices, int32 FinalSize);
+	void PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters);
+	//~End of FFastArraySerializer contract
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FFastArraySerializer::FastArrayDeltaSerialize<FGameplayTagStack, FGameplayTagStackContainer>(Stacks, DeltaParms, *this);
 	}
+
+	FOnGameplayTagStackChanged OnStackChanged;
+
 private:
-	TMap<FGameplayTag, int32> TagMap;
+	struct FLookupEntry
+	{
+		FName TagName;
+		int32 Count = 0;
+
+		/** Stacks 안의 위치 */
+		int32 StackIndex = INDEX_NONE;
+	};
+
+	/** 태그가 들어갈(또는 있는) 위치 */
+	int32 LowerBoundLookup(FName TagName) const;
+
+	int32 FindLookupIndex(FGameplayTag Tag) const
+	{
+		const FName TagName = Tag.GetTagName();
+		const int32 LookupIndex = LowerBoundLookup(TagName);
+		return (Lookup.IsValidIndex(LookupIndex) && Lookup[LookupIndex].TagName == TagName) ? LookupIndex : INDEX_NONE;
+	}
+
+	void RemoveLookupAt(int32 LookupIndex);
+
+	UPROPERTY()
+	TArray<FGameplayTagStack> Stacks;
+
+	/** TagName(FName 인덱스) 순으로 정렬 */
+	TArray<FLookupEntry, TInlineAllocator<8>> Lookup;
+};
+
+template<>
+struct TStructOpsTypeTraits<FGameplayTagStackContainer> : public TStructOpsTypeTraitsBase2<FGameplayTagStackContainer>
+{
+	enum
+	{
+		WithNetDeltaSerializer = true,
+	};
 };
@@ -0,0 +1,117 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ProFXManagerSubsystem.generated.h"
+
+class UNiagaraComponent;
+class UNiagaraSystem;
+class USceneComponent;
+
+DECLARE_STATS_GROUP(TEXT("ShooterPro FX"), STATGROUP_ProFX, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Spawned FX"), STAT_ProFX_Spawned, STATGROUP_ProFX, SHOOTERPRO_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Reused FX"), STAT_ProFX_Reused, STATGROUP_ProFX, SHOOTERPRO_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Culled FX"), STAT_ProFX_Culled, STATGROUP_ProFX, SHOOTERPRO_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Active FX"), STAT_ProFX_Active, STATGROUP_ProFX, SHOOTERPRO_API);
+
+/** 나이아가라 시스템 하나에 대한 컴포넌트 풀 */
+USTRUCT()
+struct FProFXPool
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY()
+	TArray<TObjectPtr<UNiagaraComponent>> FreeComponents;
+
+	UPROPERTY()
+	TArray<TObjectPtr<UNiagaraComponent>> ActiveComponents;
+};
+
+/**
+ * 피격/충돌 나이아가라 이펙트를 예산 안에서 재사용하는 매니저
+ * - 시스템별로 컴포넌트 풀을 두고, 재생이 끝난 컴포넌트는 파괴하지 않고 대기 목록으로 돌린다.
+ * - 프레임당 새로 재생할 수 있는 개수(MaxSpawnsPerFrame)를 넘으면 버린다.
+ * - 모든 로컬 플레이어 시점에서 CullDistance보다 멀거나, 등 뒤에 있으면서 AlwaysRelevantDistance보다 멀면 버린다.
+ * - 시스템별 동시 재생 수(MaxInstancesPerSystem)에 도달하면 가장 먼(중요도가 낮은) 인스턴스를 끊고 재사용하고,
+ *   새 요청이 그보다 멀면 버린다.
+ * - "stat ProFX"로 스폰/재사용/컬링/활성 개수를 확인할 수 있다.
+ * - 반환된 컴포넌트는 재생이 끝나면 다른 요청에 재사용되므로 들고 있으면 안 된다.
+ */
+UCLASS(Config=Game)
+class SHOOTERPRO_API UProFXManagerSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	//~ Begin UWorldSubsystem interface
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+	//~ End UWorldSubsystem interface
+
+public:
+	/** 위치에 재생. 예산/컬링에 걸리면 nullptr */
+	UFUNCTION(BlueprintCallable, Category="FX Manager")
+	UNiagaraComponent* SpawnAtLocation(UNiagaraSystem* System, FVector Location, FRotator Rotation, FVector Scale = FVector(1.0f));
+
+	/** 컴포넌트에 붙여서 재생 (LocationType 의미는 UNiagaraFunctionLibrary::SpawnSystemAttached와 같음). 예산/컬링에 걸리면 nullptr */
+	UFUNCTION(BlueprintCallable, Category="FX Manager")
+	UNiagaraComponent* SpawnAttached(UNiagaraSystem* System, USceneComponent* AttachToComponent, FName AttachPointName, FVector Location, FRotator Rotation, EAttachLocation::Type LocationType);
+
+	/** 서브시스템이 있으면 풀을 통해, 없으면(에디터 월드 등) UNiagaraFunctionLibrary로 재생 */
+	static void SpawnSystemAtLocation(const UObject* WorldContextObject, UNiagaraSystem* System, const FVector& Location, const FRotator& Rotation, const FVector& Scale = FVector(1.0f));
+	static void SpawnSystemAttached(UNiagaraSystem* System, USceneComponent* AttachToComponent, FName AttachPointName, const FVector& Location, const FRotator& Rotation, EAttachLocation::Type LocationType);
+
+	UFUNCTION(BlueprintPure, Category="FX Manager")
+	int32 GetNumActive() const { return NumActive; }
+
+private:
+	/** 예산, 시야/거리, 동시 재생 수를 확인하고 재생할 컴포넌트를 준비한다. 버려지면 nullptr */
+	UNiagaraComponent* AcquireComponent(UNiagaraSystem* System, const FVector& Location);
+
+	/** 로컬 플레이어 시점 기준으로 보이는 범위인지, 그리고 가장 가까운 시점까지의 거리 제곱 */
+	bool IsRelevant(const FVector& Location, double& OutDistanceSquared) const;
+
+	/** 시점까지의 가장 가까운 거리 제곱 (중요도 비교용) */
+	double GetViewDistanceSquared(const FVector& Location) const;
+
+	UFUNCTION()
+	void OnComponentFinished(UNiagaraComponent* Component);
+
+	void ReleaseComponent(UNiagaraComponent* Component);
+
+	AActor* GetOrCreateHostActor();
+
+protected:
+	/** 프레임당 새로 재생할 수 있는 최대 개수 */
+	UPROPERTY(Config)
+	int32 MaxSpawnsPerFrame = 16;
+
+	/** 시스템별 동시 재생 최대 개수 */
+	UPROPERTY(Config)
+	int32 MaxInstancesPerSystem = 24;
+
+	/** 이 거리보다 멀면 재생하지 않음 */
+	UPROPERTY(Config)
+	float CullDistance = 6000.0f;
+
+	/** 이 거리 안이면 시야 밖이어도 재생 (카메라 바로 뒤 충돌 등) */
+	UPROPERTY(Config)
+	float AlwaysRelevantDistance = 800.0f;
+
+	/** 시야 판정 시 카메라 정면과의 최소 코사인 (음수면 옆쪽까지 포함) */
+	UPROPERTY(Config)
+	float MinViewDot = -0.2f;
+
+private:
+	UPROPERTY()
+	TMap<TObjectPtr<UNiagaraSystem>, FProFXPool> Pools;
+
+	/** 풀 컴포넌트의 Outer. 붙이지 않는 이펙트는 이 액터 아래에서 월드 위치로 재생 */
+	UPROPERTY(Transient)
+	TObjectPtr<AActor> HostActor;
+
+	uint64 BudgetFrame = 0;
+	int32 SpawnsThisFrame = 0;
+	int32 NumActive = 0;
+};
@@ -20,7 +20,7 @@ public class ShooterPro : ModuleRules
 		{
 			"Core", "CoreUObject", "Engine", "InputCore", "EnhancedInput" ,"AIModule","NavigationSystem",
 			"ModularGameplay","UMG",
-			"FunctionalTesting", "GameplayTags",
+			"FunctionalTesting", "GameplayTags", "NetCore",
 			"GameplayAbilities","GameplayTasks", 
 			"AIModule","GameplayBehaviorsModule",
 			"MotionWarping",